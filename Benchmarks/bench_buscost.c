@@ -0,0 +1,307 @@
+/**
+ *  @brief     Bus cost of every public DS3231 API and of common workflows.
+ *  @details   Runs each call against the simulator through a counting transport and reports transactions,
+ *             bytes on the wire and wire time at 100 kHz, 400 kHz and 1 MHz, including START/STOP and
+ *             address overhead.\n
+ *             bench_buscost [--out results.json]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231.h"
+#include "DS3231_Scratchpad.h"
+#include "DS3231_Image.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct BusCase {
+    const char *name;
+    void (*run)(void);
+    void (*prepare)(void);      /* Optional, runs before the counters are reset */
+} BusCase;
+
+static const uint32_t scl_rates[] = { 100000, 400000, 1000000 };
+#define NUM_RATES (sizeof(scl_rates) / sizeof(scl_rates[0]))
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+static DS3231_State state;
+static DS3231_DateTime datetime = { DS3231_FRI, 16, 10, 2026, 12, 30, 0, DS3231_ENABLED };
+static D3231_Alarm1 alarm1 = { 0, 0, 7, 1, DS3231_A1_MATCH_S_M_H, DS3231_ENABLED };
+static D3231_Alarm2 alarm2 = { 30, 6, 1, DS3231_A2_MATCH_M_H, DS3231_ENABLED };
+static uint8_t regs[7];
+static DS3231_Config config_alarms = { DS3231_ENABLED, DS3231_DISABLED, DS3231_ALARM_INTERRUPT, DS3231_RATE_1HZ,
+        DS3231_DISABLED, 0, { 0, 0, 7, 1, DS3231_A1_MATCH_S_M_H, DS3231_ENABLED },
+        { 30, 6, 1, DS3231_A2_MATCH_M_H, DS3231_ENABLED } };
+static DS3231_Config config_sqw = { DS3231_ENABLED, DS3231_ENABLED, DS3231_SQUARE_WAVE_INTERRUPT, DS3231_RATE_1HZ,
+        DS3231_DISABLED, 0, { 0, 0, 0, 1, DS3231_A1_EVERY_S, DS3231_DISABLED },
+        { 0, 0, 1, DS3231_A2_EVERY_M, DS3231_DISABLED } };
+
+/*------------------------------------ PUBLIC API -----------------------------------------------*/
+static void api_init(void) { DS3231_Init(&hi2c); }
+static void api_init_fast(void) { DS3231_InitFast(&hi2c, &config_alarms, DS3231_DISABLED, NULL, NULL); }
+static void api_set_bbsqw(void) { DS3231_SetBatterySquareWave(DS3231_ENABLED); }
+static void api_get_bbsqw(void) { DS3231_GetBatterySquareWave(&state); }
+static void api_set_osc(void) { DS3231_SetOscillator(DS3231_ENABLED); }
+static void api_get_osf(void) { DS3231_GetOscillatorStoppedFlag(&state); }
+static void api_set_32k(void) { DS3231_Set32kHzOutput(DS3231_DISABLED); }
+static void api_get_32k(void) { DS3231_Get32kHzEnabled(&state); }
+static void api_set_intmode(void) { DS3231_SetInterruptMode(DS3231_ALARM_INTERRUPT); }
+static void api_get_intmode(void) { DS3231_InterruptMode m; DS3231_GetInterruptMode(&m); }
+static void api_set_rate(void) { DS3231_SetRateSelect(DS3231_RATE_1HZ); }
+static void api_get_rate(void) { DS3231_Rate r; DS3231_GetRateSelect(&r); }
+static void api_get_temp(void) { float t; DS3231_GetTemperature(&t); }
+static void api_set_a1(void) { DS3231_SetAlarm1(&alarm1); }
+static void api_get_a1(void) { D3231_Alarm1 a; DS3231_GetAlarm1(&a); }
+static void api_set_a1ie(void) { DS3231_SetAlarm1IntEn(DS3231_ENABLED); }
+static void api_get_a1ie(void) { DS3231_GetAlarm1IntEn(&state); }
+static void api_get_a1f(void) { DS3231_GetAlarm1Flag(&state); }
+static void api_clr_a1f(void) { DS3231_ClearAlarm1Flag(); }
+static void api_set_a2(void) { DS3231_SetAlarm2(&alarm2); }
+static void api_get_a2(void) { D3231_Alarm2 a; DS3231_GetAlarm2(&a); }
+static void api_set_a2ie(void) { DS3231_SetAlarm2IntEn(DS3231_ENABLED); }
+static void api_get_a2ie(void) { DS3231_GetAlarm2IntEn(&state); }
+static void api_get_a2f(void) { DS3231_GetAlarm2Flag(&state); }
+static void api_clr_a2f(void) { DS3231_ClearAlarm2Flag(); }
+static void api_get_config(void) { DS3231_Config c; DS3231_GetConfig(&c); }
+static void api_apply_config(void) { DS3231_ApplyConfig(&config_sqw, NULL); }
+static void api_set_dt(void) { DS3231_SetDateTime(&datetime); }
+static void api_get_dt(void) { DS3231_DateTime dt; DS3231_GetDateTime(&dt); }
+static void api_write_reg(void) { DS3231_WriteRegister(DS3231_REG_AGING, regs); }
+static void api_write_regs(void) { DS3231_WriteRegisters(DS3231_REG_SECOND, regs, 7); }
+static void api_read_reg(void) { DS3231_ReadRegister(DS3231_REG_STATUS, regs); }
+static void api_read_regs(void) { DS3231_ReadRegisters(DS3231_REG_SECOND, regs, 7); }
+static void api_scratch_read(void) { uint16_t data; DS3231_Scratchpad_Read(&data); }
+static void api_scratch_write(void) { DS3231_Scratchpad_Write(0x2A); }
+
+/*------------------------------------ WORKFLOWS ------------------------------------------------*/
+static void flow_bringup(void) {
+    DS3231_State osf;
+    DS3231_Init(&hi2c);
+    DS3231_GetOscillatorStoppedFlag(&osf);
+    DS3231_SetDateTime(&datetime);
+}
+
+static void flow_read_unix(void) {
+    DS3231_DateTime dt;
+    uint32_t unixtime;
+    DS3231_GetDateTime(&dt);
+    DS3231_ToUnixTime(&dt, &unixtime);
+}
+
+static void flow_rearm_alarm1(void) {
+    DS3231_ClearAlarm1Flag();
+    DS3231_SetAlarm1(&alarm1);
+}
+
+static void flow_service_interrupt(void) {
+    DS3231_State a1f, a2f;
+    DS3231_GetAlarm1Flag(&a1f);
+    DS3231_GetAlarm2Flag(&a2f);
+    if (a1f)
+        DS3231_ClearAlarm1Flag();
+    if (a2f)
+        DS3231_ClearAlarm2Flag();
+}
+
+static void flow_raise_alarm1(void) {
+    /* Leave an alarm pending so the interrupt workflow takes its clearing path. */
+    sim.Regs[DS3231_REG_STATUS] |= (1 << DS3231_A1F);
+}
+
+static void flow_configure_sqw(void) {
+    DS3231_SetRateSelect(DS3231_RATE_1HZ);
+    DS3231_SetInterruptMode(DS3231_SQUARE_WAVE_INTERRUPT);
+    DS3231_SetBatterySquareWave(DS3231_ENABLED);
+    DS3231_Set32kHzOutput(DS3231_DISABLED);
+}
+
+/* Full mode switch from alarm interrupts to a battery backed 1 Hz square wave with both alarms off. */
+static void flow_mode_switch_setters(void) {
+    DS3231_SetOscillator(config_sqw.Oscillator);
+    DS3231_SetRateSelect(config_sqw.Rate);
+    DS3231_SetAlarm1(&config_sqw.Alarm1);
+    DS3231_SetAlarm2(&config_sqw.Alarm2);
+    DS3231_SetInterruptMode(config_sqw.InterruptMode);
+    DS3231_SetBatterySquareWave(config_sqw.BatterySquareWave);
+    DS3231_Set32kHzOutput(config_sqw.Output32kHz);
+    DS3231_WriteRegister(DS3231_REG_AGING, (uint8_t *) &config_sqw.AgingOffset);
+}
+
+static void flow_mode_switch_config(void) {
+    DS3231_ApplyConfig(&config_sqw, NULL);
+}
+
+static void flow_mode_alarms(void) {
+    DS3231_ApplyConfig(&config_alarms, NULL);
+}
+
+/* Wake from standby with the chip still configured, then the pending alarm flags are handled by the caller. */
+static void flow_warm_boot_init(void) {
+    DS3231_Init(&hi2c);
+    DS3231_ApplyConfig(&config_alarms, NULL);
+}
+
+static void flow_warm_boot_initfast(void) {
+    uint8_t events;
+    DS3231_InitFast(&hi2c, &config_alarms, DS3231_DISABLED, &events, NULL);
+}
+
+/* Per-board setup on a provisioning line: time, both alarms, outputs and aging, flags cleared. */
+static uint8_t golden_image[DS3231_IMAGE_SIZE];
+
+static void flow_provision_api(void) {
+    int8_t aging = -3;
+    DS3231_SetDateTime(&datetime);
+    DS3231_SetAlarm1(&alarm1);
+    DS3231_SetAlarm2(&alarm2);
+    DS3231_Set32kHzOutput(DS3231_DISABLED);
+    DS3231_WriteRegister(DS3231_REG_AGING, (uint8_t *) &aging);
+    DS3231_ClearAlarm1Flag();
+    DS3231_ClearAlarm2Flag();
+}
+
+static void flow_provision_image(void) {
+    DS3231_ImportImage(golden_image, 42);
+}
+
+static void flow_golden_image(void) {
+    flow_provision_api();
+    DS3231_ExportImage(golden_image, DS3231_IMAGE_ALL);
+}
+
+/* Boot counter kept in the Alarm 2 registers across MCU power loss. */
+static void flow_boot_counter(void) {
+    uint16_t boots = 0;
+    DS3231_Scratchpad_Read(&boots);
+    DS3231_Scratchpad_Write((uint16_t) (boots + 1));
+}
+
+static void flow_scratchpad_free(void) {
+    DS3231_SetAlarm2IntEn(DS3231_DISABLED);
+    DS3231_Scratchpad_Write(41);
+}
+
+static const BusCase api_cases[] = {
+    { "DS3231_Init", api_init, NULL },
+    { "DS3231_InitFast", api_init_fast, flow_mode_alarms },
+    { "DS3231_SetBatterySquareWave", api_set_bbsqw, NULL },
+    { "DS3231_GetBatterySquareWave", api_get_bbsqw, NULL },
+    { "DS3231_SetOscillator", api_set_osc, NULL },
+    { "DS3231_GetOscillatorStoppedFlag", api_get_osf, NULL },
+    { "DS3231_Set32kHzOutput", api_set_32k, NULL },
+    { "DS3231_Get32kHzEnabled", api_get_32k, NULL },
+    { "DS3231_SetInterruptMode", api_set_intmode, NULL },
+    { "DS3231_GetInterruptMode", api_get_intmode, NULL },
+    { "DS3231_SetRateSelect", api_set_rate, NULL },
+    { "DS3231_GetRateSelect", api_get_rate, NULL },
+    { "DS3231_GetTemperature", api_get_temp, NULL },
+    { "DS3231_SetAlarm1", api_set_a1, NULL },
+    { "DS3231_GetAlarm1", api_get_a1, NULL },
+    { "DS3231_SetAlarm1IntEn", api_set_a1ie, NULL },
+    { "DS3231_GetAlarm1IntEn", api_get_a1ie, NULL },
+    { "DS3231_GetAlarm1Flag", api_get_a1f, NULL },
+    { "DS3231_ClearAlarm1Flag", api_clr_a1f, NULL },
+    { "DS3231_SetAlarm2", api_set_a2, NULL },
+    { "DS3231_GetAlarm2", api_get_a2, NULL },
+    { "DS3231_SetAlarm2IntEn", api_set_a2ie, NULL },
+    { "DS3231_GetAlarm2IntEn", api_get_a2ie, NULL },
+    { "DS3231_GetAlarm2Flag", api_get_a2f, NULL },
+    { "DS3231_ClearAlarm2Flag", api_clr_a2f, NULL },
+    { "DS3231_GetConfig", api_get_config, NULL },
+    { "DS3231_ApplyConfig", api_apply_config, NULL },
+    { "DS3231_SetDateTime", api_set_dt, NULL },
+    { "DS3231_GetDateTime", api_get_dt, NULL },
+    { "DS3231_WriteRegister", api_write_reg, NULL },
+    { "DS3231_WriteRegisters(7)", api_write_regs, NULL },
+    { "DS3231_ReadRegister", api_read_reg, NULL },
+    { "DS3231_ReadRegisters(7)", api_read_regs, NULL },
+    { "DS3231_Scratchpad_Read", api_scratch_read, flow_scratchpad_free },
+    { "DS3231_Scratchpad_Write", api_scratch_write, flow_scratchpad_free },
+};
+
+static const BusCase flow_cases[] = {
+    { "bring-up: init, check OSF, set time", flow_bringup, NULL },
+    { "read time as unix seconds", flow_read_unix, NULL },
+    { "re-arm alarm 1", flow_rearm_alarm1, NULL },
+    { "service alarm interrupt", flow_service_interrupt, flow_raise_alarm1 },
+    { "configure 1 Hz square wave", flow_configure_sqw, NULL },
+    { "mode switch, individual setters", flow_mode_switch_setters, flow_mode_alarms },
+    { "mode switch, DS3231_ApplyConfig", flow_mode_switch_config, flow_mode_alarms },
+    { "warm boot, DS3231_Init + ApplyConfig", flow_warm_boot_init, flow_mode_alarms },
+    { "warm boot, DS3231_InitFast", flow_warm_boot_initfast, flow_mode_alarms },
+    { "provision, individual API calls", flow_provision_api, NULL },
+    { "provision, DS3231_ImportImage", flow_provision_image, flow_golden_image },
+    { "boot counter in the scratchpad", flow_boot_counter, flow_scratchpad_free },
+};
+
+/*------------------------------------ REPORTING ------------------------------------------------*/
+static void measure(const BusCase *c, FILE *json, int *first) {
+    uint64_t wire_ns[NUM_RATES];
+    if (c->prepare)
+        c->prepare();
+    DS3231_BusCounter_Reset(&counter);
+    c->run();
+    printf("%-38s %5u %6u", c->name, (unsigned) DS3231_BusCounter_Transactions(&counter),
+           (unsigned) counter.WireBytes);
+    for (unsigned r = 0; r < NUM_RATES; r++) {
+        wire_ns[r] = DS3231_BusCounter_WireTime_ns(&counter, scl_rates[r]);
+        printf(" %10.1f", wire_ns[r] / 1000.0);
+    }
+    printf("\n");
+    if (json == NULL)
+        return;
+    fprintf(json, "%s    { \"name\": \"%s\", \"transactions\": %u, \"reads\": %u, \"writes\": %u, "
+            "\"data_bytes\": %u, \"wire_bytes\": %u, \"wire_us\": { \"100k\": %.2f, \"400k\": %.2f, "
+            "\"1M\": %.2f } }", *first ? "" : ",\n", c->name, (unsigned) DS3231_BusCounter_Transactions(&counter),
+            (unsigned) counter.Reads, (unsigned) counter.Writes, (unsigned) counter.DataBytes,
+            (unsigned) counter.WireBytes, wire_ns[0] / 1000.0, wire_ns[1] / 1000.0, wire_ns[2] / 1000.0);
+    *first = 0;
+}
+
+static void header(const char *title) {
+    printf("\n%-38s %5s %6s %10s %10s %10s\n", title, "xfers", "bytes", "100k us", "400k us", "1M us");
+}
+
+int main(int argc, char **argv) {
+    FILE *json = NULL;
+    int first = 1;
+    if (argc == 3 && strcmp(argv[1], "--out") == 0) {
+        json = fopen(argv[2], "w");
+        if (json == NULL) {
+            perror(argv[2]);
+            return 2;
+        }
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [--out file.json]\n", argv[0]);
+        return 2;
+    }
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+
+    if (json)
+        fprintf(json, "{\n  \"suite\": \"buscost\",\n  \"apis\": [\n");
+    header("API");
+    for (unsigned i = 0; i < sizeof(api_cases) / sizeof(api_cases[0]); i++)
+        measure(&api_cases[i], json, &first);
+    if (json)
+        fprintf(json, "\n  ],\n  \"workflows\": [\n");
+    first = 1;
+    header("Workflow");
+    for (unsigned i = 0; i < sizeof(flow_cases) / sizeof(flow_cases[0]); i++)
+        measure(&flow_cases[i], json, &first);
+    if (json) {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+/**
+ *  @brief     Cost and accuracy of ds3231::clock::now() against the simulator.
+ *  @details   Calls now() in a tight loop while the simulator advances about 100 us per call, the clock is set
+ *             half way through. Every result is compared with the simulator's true time (time registers plus the
+ *             position in the countdown chain). Reports bus transactions per call, the worst error once the clock
+ *             has locked to the second boundary and the host cost of a call served from the cache, next to
+ *             DS3231_GetDateTime + DS3231_ToUnixTime. Exits with 1 if time goes backwards outside the set or the
+ *             locked error exceeds DS3231_CLOCK_POLL_MS + 2 ms.\n
+ *             bench_clock [--seconds N] [--step-us N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Clock.hpp"
+#include "DS3231_RawTime.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if !DS3231_USE_CACHE
+#error "bench_clock checks that setting the time restarts the clock, build it with DS3231_USE_CACHE=1"
+#endif
+
+#define SETTLE_MS   (1000 + 4 * DS3231_CLOCK_POLL_MS)   /* Worst case until the first boundary is located */
+#define HOT_CALLS   10000000UL
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+static volatile std::int64_t sink;
+
+static std::uint32_t rng_state = 0x6C078965UL;
+
+static std::uint32_t bench_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static double host_ns(void) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* The simulator's time in ms, read without going through the bus. */
+static double true_ms(void) {
+    DS3231_RawTime raw;
+    DS3231_DateTime dt;
+    std::memcpy(raw.Regs, sim.Regs, sizeof(raw.Regs));
+    DS3231_RawTime_ToDateTime(&raw, &dt);
+    return ds3231::to_unix_seconds(dt) * 1000.0 + sim.SubSecond_ns / 1e6;
+}
+
+static void report(const char *name, std::uint32_t calls, double ns_per_call) {
+    std::uint32_t xfers = DS3231_BusCounter_Transactions(&counter);
+    std::printf("%-34s %9u %8u %10.5f %12.3f %10.1f\n", name, (unsigned) calls, (unsigned) xfers,
+                (double) xfers / calls, DS3231_BusCounter_WireTime_ns(&counter, 400000) / 1000.0 / calls,
+                ns_per_call);
+}
+
+int main(int argc, char **argv) {
+    std::uint32_t seconds = 60, step_us = 100, calls, backwards = 0;
+    double max_error = 0, t0;
+    std::uint64_t settle_until;
+    DS3231_DateTime start = { DS3231_FRI, 16, 10, 2026, 23, 59, 30, DS3231_ENABLED };
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--seconds") == 0)
+            seconds = std::strtoul(argv[i + 1], NULL, 0);
+        else if (std::strcmp(argv[i], "--step-us") == 0)
+            step_us = std::strtoul(argv[i + 1], NULL, 0);
+    }
+    if (seconds == 0 || step_us == 0)
+        return 2;
+    calls = (std::uint32_t) (seconds * 1000000ULL / step_us);
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_Sim_SetBusClock(&sim, 400000);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start);
+    DS3231_Sim_Advance(&sim, 123456789ULL);         /* Put the second boundary away from a tick boundary */
+
+    std::printf("%-34s %9s %8s %10s %12s %10s\n", "source", "calls", "xfers", "xfers/call", "400k us/call",
+                "host ns");
+
+    DS3231_BusCounter_Reset(&counter);
+    t0 = host_ns();
+    for (std::uint32_t i = 0; i < calls; i++) {
+        DS3231_DateTime dt;
+        std::uint32_t unixtime;
+        DS3231_GetDateTime(&dt);
+        DS3231_ToUnixTime(&dt, &unixtime);
+        sink += unixtime;
+        DS3231_Sim_Advance(&sim, (step_us / 2 + bench_rand() % step_us) * 1000ULL);
+    }
+    report("GetDateTime + ToUnixTime", calls, (host_ns() - t0) / calls);
+
+    DS3231_BusCounter_Reset(&counter);
+    ds3231::clock::time_point previous {};
+    settle_until = DS3231_Sim_Now(&sim) + SETTLE_MS * 1000000ULL;
+    t0 = host_ns();
+    for (std::uint32_t i = 0; i < calls; i++) {
+        if (i == calls / 2) {
+            DS3231_SetDateTime(&start);
+            settle_until = DS3231_Sim_Now(&sim) + SETTLE_MS * 1000000ULL;
+            previous = ds3231::clock::time_point {};
+        }
+        const double before = true_ms();
+        const ds3231::clock::time_point t = ds3231::clock::now();
+        const double ms = (double) t.time_since_epoch().count();
+        if (t < previous) {
+            if (backwards++ == 0)
+                std::fprintf(stderr, "now() went back %lld ms at call %u\n",
+                             (long long) (previous - t).count(), (unsigned) i);
+        }
+        previous = t;
+        if (DS3231_Sim_Now(&sim) >= settle_until) {
+            /* The bus time of a resync lies between before and after, as does the tick truncation. */
+            const double after = true_ms();
+            const double error = ms < before - 1 ? before - 1 - ms : ms > after ? ms - after : 0;
+            if (error > max_error)
+                max_error = error;
+        }
+        DS3231_Sim_Advance(&sim, (step_us / 2 + bench_rand() % step_us) * 1000ULL);
+    }
+    report("ds3231::clock::now()", calls, (host_ns() - t0) / calls);
+
+    /* Pure cache hits, the simulator stands still. */
+    DS3231_BusCounter_Reset(&counter);
+    t0 = host_ns();
+    for (std::uint32_t i = 0; i < HOT_CALLS; i++)
+        sink += ds3231::clock::now().time_since_epoch().count();
+    report("ds3231::clock::now(), cache hit", HOT_CALLS, (host_ns() - t0) / HOT_CALLS);
+
+    std::printf("max error after lock %.3f ms, %u backward steps\n", max_error, (unsigned) backwards);
+    if (backwards || max_error > DS3231_CLOCK_POLL_MS + 2) {
+        std::fprintf(stderr, "clock out of bounds\n");
+        return 1;
+    }
+    return 0;
+}
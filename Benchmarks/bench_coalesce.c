@@ -0,0 +1,210 @@
+/**
+ *  @brief     Bus cost of concurrent DS3231_GetDateTime callers with and without single-flight sharing.
+ *  @details   1 to 64 threads each read the time every millisecond from a simulated DS3231 whose transactions
+ *             take their 400 kHz wire time in real time. Each thread count runs three ways: every caller doing
+ *             its own read under a bus mutex, #DS3231_SetAsyncPort sharing the read in flight, and sharing with
+ *             a 5 ms freshness window. Prints transactions per call and the mean call latency. Exits with 1 on a
+ *             failed read, a time going backwards within a thread, or when sharing does not keep the
+ *             transactions at 64 threads within 4 times those at 1 thread.\n
+ *             bench_coalesce [--calls N] [--max-threads N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "DS3231.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BUS_HZ      400000
+#define PERIOD_NS   1000000L
+#define MAX_THREADS 64
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+/*------------------------------------ WIRE TIME TRANSPORT --------------------------------------*/
+/* Forwards to the counter and sleeps for the wire time of the transaction. */
+static const HAL_I2C_Transport *wire_inner;
+static void *wire_context;
+
+static void sleep_ns(uint64_t ns) {
+    struct timespec ts = { (time_t) (ns / 1000000000ULL), (long) (ns % 1000000000ULL) };
+    nanosleep(&ts, NULL);
+}
+
+static uint64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static HAL_StatusTypeDef wire_write(void *context, uint16_t DevAddress, uint16_t MemAddress, const uint8_t *pData,
+                                    uint16_t Size) {
+    uint64_t before = DS3231_BusCounter_WireTime_ns(&counter, BUS_HZ);
+    HAL_StatusTypeDef status = wire_inner->MemWrite(wire_context, DevAddress, MemAddress, pData, Size);
+    (void) context;
+    sleep_ns(DS3231_BusCounter_WireTime_ns(&counter, BUS_HZ) - before);
+    return status;
+}
+
+static HAL_StatusTypeDef wire_read(void *context, uint16_t DevAddress, uint16_t MemAddress, uint8_t *pData,
+                                   uint16_t Size) {
+    uint64_t before = DS3231_BusCounter_WireTime_ns(&counter, BUS_HZ);
+    HAL_StatusTypeDef status = wire_inner->MemRead(wire_context, DevAddress, MemAddress, pData, Size);
+    (void) context;
+    sleep_ns(DS3231_BusCounter_WireTime_ns(&counter, BUS_HZ) - before);
+    return status;
+}
+
+static const HAL_I2C_Transport wire_transport = { wire_write, wire_read };
+
+/*------------------------------------ PTHREAD PORT ---------------------------------------------*/
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+
+static void port_lock(void *context) {
+    pthread_mutex_lock(context);
+}
+
+static void port_unlock(void *context) {
+    pthread_mutex_unlock(context);
+}
+
+static void port_wait(void *context) {
+    pthread_cond_wait(&cond, context);
+}
+
+static void port_broadcast(void *context) {
+    (void) context;
+    pthread_cond_broadcast(&cond);
+}
+
+static const DS3231_AsyncPort port = { port_lock, port_unlock, port_wait, port_broadcast, &mutex };
+
+/*------------------------------------ WORKLOAD -------------------------------------------------*/
+typedef enum Mode {
+    MODE_MUTEX,
+    MODE_SHARED,
+    MODE_FRESH
+} Mode;
+
+static const char *const mode_names[] = { "bus mutex", "single-flight", "single-flight, 5 ms fresh" };
+
+typedef struct Job {
+    pthread_t thread;
+    Mode mode;
+    uint32_t calls;
+    uint64_t latency_ns;
+    uint32_t errors;
+} Job;
+
+static uint32_t seconds_of(const DS3231_DateTime *dt) {
+    return ((uint32_t) dt->Date * 24 + dt->Hour_24mode) * 3600UL + dt->Minute * 60UL + dt->Second;
+}
+
+static void *worker(void *arg) {
+    Job *job = arg;
+    uint32_t last = 0;
+    for (uint32_t i = 0; i < job->calls; i++) {
+        DS3231_DateTime dt;
+        HAL_StatusTypeDef status;
+        uint64_t t0 = host_ns();
+        if (job->mode == MODE_MUTEX) {
+            pthread_mutex_lock(&mutex);
+            status = DS3231_GetDateTime(&dt);
+            pthread_mutex_unlock(&mutex);
+        } else {
+            status = DS3231_GetDateTime(&dt);
+        }
+        job->latency_ns += host_ns() - t0;
+        if (status != HAL_OK || seconds_of(&dt) < last)
+            job->errors++;
+        last = seconds_of(&dt);
+        sleep_ns(PERIOD_NS);
+    }
+    return NULL;
+}
+
+/* Runs one thread count in one mode, returns the transactions issued. */
+static uint32_t run(uint32_t threads, Mode mode, uint32_t calls, double *latency_us, uint32_t *errors) {
+    static Job jobs[MAX_THREADS];
+    uint64_t latency = 0;
+    DS3231_SetAsyncPort(mode == MODE_MUTEX ? NULL : &port, mode == MODE_FRESH ? 5 : 0);
+    DS3231_BusCounter_Reset(&counter);
+    for (uint32_t i = 0; i < threads; i++) {
+        memset(&jobs[i], 0, sizeof(jobs[i]));
+        jobs[i].mode = mode;
+        jobs[i].calls = calls;
+        pthread_create(&jobs[i].thread, NULL, worker, &jobs[i]);
+    }
+    for (uint32_t i = 0; i < threads; i++) {
+        pthread_join(jobs[i].thread, NULL);
+        latency += jobs[i].latency_ns;
+        *errors += jobs[i].errors;
+    }
+    *latency_us = latency / 1000.0 / ((double) threads * calls);
+    return DS3231_BusCounter_Transactions(&counter);
+}
+
+int main(int argc, char **argv) {
+    uint32_t calls = 100, max_threads = MAX_THREADS, errors = 0;
+    uint32_t shared_first = 0, shared_last = 0;
+    DS3231_DateTime start = { DS3231_FRI, 16, 10, 2026, 12, 0, 0, DS3231_ENABLED };
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--calls") == 0)
+            calls = strtoul(argv[i + 1], NULL, 0);
+        else if (strcmp(argv[i], "--max-threads") == 0)
+            max_threads = strtoul(argv[i + 1], NULL, 0);
+    }
+    if (calls == 0 || max_threads == 0 || max_threads > MAX_THREADS)
+        return 2;
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_Sim_SetBusClock(&sim, BUS_HZ);
+    HAL_Host_SetTickSource(NULL, NULL, NULL);   /* The freshness window runs on real time */
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    wire_inner = hi2c.Transport;
+    wire_context = hi2c.Context;
+    HAL_Host_BindI2C(&hi2c, &wire_transport, NULL);
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start);
+
+    printf("%d calls per thread, one every %ld us, %d kHz bus\n", (int) calls, PERIOD_NS / 1000, BUS_HZ / 1000);
+    printf("%8s %-26s %12s %10s %12s\n", "threads", "mode", "transactions", "per call", "latency us");
+    for (uint32_t threads = 1; threads <= max_threads; threads *= 2) {
+        for (int mode = MODE_MUTEX; mode <= MODE_FRESH; mode++) {
+            double latency_us;
+            uint32_t xfers = run(threads, (Mode) mode, calls, &latency_us, &errors);
+            printf("%8u %-26s %12u %10.3f %12.1f\n", (unsigned) threads, mode_names[mode], (unsigned) xfers,
+                   (double) xfers / ((double) threads * calls), latency_us);
+            if (mode == MODE_SHARED) {
+                shared_last = xfers;
+                if (threads == 1)
+                    shared_first = xfers;
+            }
+        }
+    }
+    DS3231_SetAsyncPort(NULL, 0);
+
+    if (errors) {
+        fprintf(stderr, "%u failed or out of order reads\n", (unsigned) errors);
+        return 1;
+    }
+    if (max_threads >= 16 && shared_last > 4 * shared_first) {
+        fprintf(stderr, "single-flight transactions grew from %u to %u\n", (unsigned) shared_first,
+                (unsigned) shared_last);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,495 @@
+/**
+ *  @brief     Microbenchmarks for the DS3231 conversion hot paths.
+ *  @details   Measures DS3231_ToUnixTime, DS3231_ToDateTime, DS3231_EncodeBCD, DS3231_DecodeBCD, the register
+ *             decode of DS3231_GetDateTime and DS3231_GetAlarm1 and the lazy DS3231_RawTime accessors over
+ *             uniform, clustered-recent and edge-date inputs. Built a second time with DS3231_USE_INLINE=1 it measures the header-only primitives.\n
+ *             On the host it reports ns/op and, when perf events are available, instructions/op. On a Cortex-M
+ *             target with a DWT unit it reports cycles/op.\n
+ *             The decode is timed on prepared register buffers through DS3231_DecodeDateTime and
+ *             DS3231_DecodeAlarm1, the paths the Get functions take after the bus read, everywhere. The host also
+ *             runs the Get functions and DS3231_SetDateTime whole over a memory transport.\n
+ *             Results are written as JSON and can be checked against a thresholds file:\n
+ *             bench_conversions [--out results.json] [--thresholds thresholds.txt] [--rounds N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#include "DS3231.h"
+#include "DS3231_RawTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define BENCH_HOST 1
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define BENCH_DWT 1
+#define DWT_CTRL    (*(volatile uint32_t *) 0xE0001000UL)
+#define DWT_CYCCNT  (*(volatile uint32_t *) 0xE0001004UL)
+#define CORE_DEMCR  (*(volatile uint32_t *) 0xE000EDFCUL)
+#endif
+
+#define BENCH_INPUTS        4096        /* Inputs per distribution, power of two */
+#define BENCH_DEFAULT_ROUNDS 64
+#define BENCH_MAX_RESULTS   48
+
+#define UNIX_2000   946684800UL
+#define UNIX_2100   4102444800UL
+#define UNIX_RECENT 1767225600UL        /* 2026-01-01 00:00:00 */
+
+typedef struct BenchResult {
+    char name[48];
+    double ns_per_op;
+    double instr_per_op;        /* < 0 when not available */
+    double cycles_per_op;       /* < 0 when not available */
+} BenchResult;
+
+typedef struct BenchInputs {
+    uint32_t unixtime[BENCH_INPUTS];
+    DS3231_DateTime dt[BENCH_INPUTS];
+    uint8_t regs[BENCH_INPUTS][7];
+    uint8_t bin[BENCH_INPUTS];
+    uint8_t bcd[BENCH_INPUTS];
+    uint8_t hour[BENCH_INPUTS];         /* Hour registers, every other one in 12 hour mode */
+} BenchInputs;
+
+static BenchInputs inputs;
+static BenchResult results[BENCH_MAX_RESULTS];
+static unsigned result_count;
+static volatile uint32_t sink;
+
+/*------------------------------------ MEASUREMENT ----------------------------------------------*/
+typedef struct BenchSample {
+    uint64_t ns;
+    uint64_t instructions;
+    uint64_t cycles;
+} BenchSample;
+
+#if BENCH_HOST
+static int perf_fd = -1;
+
+static void bench_timer_init(void) {
+    struct perf_event_attr pe;
+    memset(&pe, 0, sizeof(pe));
+    pe.type = PERF_TYPE_HARDWARE;
+    pe.size = sizeof(pe);
+    pe.config = PERF_COUNT_HW_INSTRUCTIONS;
+    pe.disabled = 1;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+    perf_fd = (int) syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+}
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static void bench_start(BenchSample *s) {
+    if (perf_fd >= 0) {
+        ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    s->ns = bench_now_ns();
+}
+
+static void bench_stop(BenchSample *s) {
+    s->ns = bench_now_ns() - s->ns;
+    s->instructions = 0;
+    s->cycles = 0;
+    if (perf_fd >= 0) {
+        long long count = 0;
+        ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(perf_fd, &count, sizeof(count)) == sizeof(count))
+            s->instructions = (uint64_t) count;
+    }
+}
+#else
+static void bench_timer_init(void) {
+#if BENCH_DWT
+    CORE_DEMCR |= (1UL << 24);      // TRCENA
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= 1UL;                // CYCCNTENA
+#endif
+}
+
+static void bench_start(BenchSample *s) {
+#if BENCH_DWT
+    s->cycles = DWT_CYCCNT;
+#endif
+    s->ns = HAL_GetTick();
+}
+
+static void bench_stop(BenchSample *s) {
+#if BENCH_DWT
+    s->cycles = DWT_CYCCNT - (uint32_t) s->cycles;
+#else
+    s->cycles = 0;
+#endif
+    s->ns = (HAL_GetTick() - (uint32_t) s->ns) * 1000000ULL;
+    s->instructions = 0;
+}
+#endif
+
+static void bench_record(const char *op, const char *dist, const BenchSample *s, uint64_t ops) {
+    BenchResult *r;
+    if (result_count >= BENCH_MAX_RESULTS)
+        return;
+    r = &results[result_count++];
+    snprintf(r->name, sizeof(r->name), "%s/%s", op, dist);
+    r->ns_per_op = (double) s->ns / (double) ops;
+#if BENCH_HOST
+    r->instr_per_op = perf_fd >= 0 ? (double) s->instructions / (double) ops : -1.0;
+    r->cycles_per_op = -1.0;
+#elif BENCH_DWT
+    r->instr_per_op = -1.0;
+    r->cycles_per_op = (double) s->cycles / (double) ops;
+#else
+    r->instr_per_op = -1.0;
+    r->cycles_per_op = -1.0;
+#endif
+}
+
+/*------------------------------------ INPUT DISTRIBUTIONS --------------------------------------*/
+static uint32_t rng_state = 0x9E3779B9UL;
+
+static uint32_t bench_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void bench_fill_unix_uniform(void) {
+    for (unsigned i = 0; i < BENCH_INPUTS; i++)
+        inputs.unixtime[i] = UNIX_2000 + bench_rand() % (UNIX_2100 - UNIX_2000);
+}
+
+static void bench_fill_unix_recent(void) {
+    /* Timestamps a logger produces: within a month of "now", mostly a few seconds apart. */
+    uint32_t t = UNIX_RECENT - 15 * 86400UL;
+    for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+        t += bench_rand() % 600;
+        inputs.unixtime[i] = t;
+    }
+}
+
+static void bench_fill_unix_edges(void) {
+    static const uint16_t years[] = { 2000, 2001, 2004, 2023, 2024, 2038, 2096, 2099 };
+    static const uint8_t month_ends[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    unsigned n = 0;
+    while (n < BENCH_INPUTS) {
+        for (unsigned y = 0; y < sizeof(years) / sizeof(years[0]) && n < BENCH_INPUTS; y++) {
+            for (uint8_t m = 1; m <= 12 && n < BENCH_INPUTS; m++) {
+                DS3231_DateTime dt = { 0 };
+                uint32_t t;
+                dt.Year = years[y];
+                dt.Month = m;
+                dt.Date = month_ends[m - 1] + (m == 2 && years[y] % 4 == 0);
+                dt.Hour_24mode = 23;
+                dt.Minute = 59;
+                dt.Second = 59;
+                DS3231_ToUnixTime(&dt, &t);
+                inputs.unixtime[n++] = t;
+                if (n < BENCH_INPUTS)
+                    inputs.unixtime[n++] = t + 1;
+            }
+        }
+    }
+}
+
+static void bench_derive_inputs(void) {
+    for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+        DS3231_DateTime *dt = &inputs.dt[i];
+        DS3231_ToDateTime(&inputs.unixtime[i], dt);
+        dt->Enable = DS3231_ENABLED;
+        inputs.regs[i][0] = DS3231_EncodeBCD(dt->Second);
+        inputs.regs[i][1] = DS3231_EncodeBCD(dt->Minute);
+        inputs.regs[i][2] = DS3231_EncodeBCD(dt->Hour_24mode);
+        inputs.regs[i][3] = DS3231_EncodeBCD(dt->Day);
+        inputs.regs[i][4] = DS3231_EncodeBCD(dt->Date);
+        inputs.regs[i][5] = DS3231_EncodeBCD(dt->Month);
+        inputs.regs[i][6] = DS3231_EncodeBCD((uint8_t) (dt->Year - 2000U));
+        inputs.bin[i] = (uint8_t) (bench_rand() % 100);
+        inputs.bcd[i] = DS3231_EncodeBCD(inputs.bin[i]);
+        inputs.hour[i] = DS3231_Hour_Encode(dt->Hour_24mode, (DS3231_HourMode) (bench_rand() & 1));
+    }
+}
+
+/*------------------------------------ REGISTER SOURCE ------------------------------------------*/
+#if BENCH_HOST
+/* Serves the prepared register images so only the driver's decode is measured. */
+static unsigned reg_cursor;
+
+static HAL_StatusTypeDef bench_mem_write(void *context, uint16_t DevAddress, uint16_t MemAddress,
+                                         const uint8_t *pData, uint16_t Size) {
+    (void) context; (void) DevAddress; (void) MemAddress; (void) pData; (void) Size;
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef bench_mem_read(void *context, uint16_t DevAddress, uint16_t MemAddress, uint8_t *pData,
+                                        uint16_t Size) {
+    (void) context; (void) DevAddress;
+    if (MemAddress == DS3231_REG_SECOND || MemAddress == DS3231_REG_A1_SECOND) {
+        memcpy(pData, inputs.regs[reg_cursor], Size);
+        reg_cursor = (reg_cursor + 1) & (BENCH_INPUTS - 1);
+    } else {
+        memset(pData, 0, Size);
+    }
+    return HAL_OK;
+}
+
+static const HAL_I2C_Transport bench_transport = { bench_mem_write, bench_mem_read };
+static I2C_HandleTypeDef bench_i2c;
+#endif
+
+/*------------------------------------ KERNELS --------------------------------------------------*/
+static void bench_run(const char *dist, unsigned rounds) {
+    BenchSample s;
+    const uint64_t ops = (uint64_t) rounds * BENCH_INPUTS;
+    uint32_t acc = 0;
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            uint32_t t;
+            DS3231_ToUnixTime(&inputs.dt[i], &t);
+            acc += t;
+        }
+    bench_stop(&s);
+    bench_record("ToUnixTime", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            DS3231_DateTime dt;
+            DS3231_ToDateTime(&inputs.unixtime[i], &dt);
+            acc += dt.Date + dt.Day + dt.Second;
+        }
+    bench_stop(&s);
+    bench_record("ToDateTime", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++)
+            acc += DS3231_EncodeBCD(inputs.bin[i]);
+    bench_stop(&s);
+    bench_record("EncodeBCD", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++)
+            acc += DS3231_DecodeBCD(inputs.bcd[i]);
+    bench_stop(&s);
+    bench_record("DecodeBCD", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++)
+            acc += DS3231_Hour_Decode(inputs.hour[i]);
+    bench_stop(&s);
+    bench_record("DecodeHour", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 1; i < BENCH_INPUTS; i++)
+            acc += DS3231_RawTime_Compare(DS3231_RAWTIME(inputs.regs[i - 1]), DS3231_RAWTIME(inputs.regs[i])) < 0;
+    bench_stop(&s);
+    bench_record("RawTimeCompare", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            DS3231_DateTime dt;
+            DS3231_DecodeDateTime(inputs.regs[i], &dt);
+            acc += dt.Date + dt.Second;
+        }
+    bench_stop(&s);
+    bench_record("DecodeDateTime", dist, &s, ops);
+
+#if DS3231_USE_ALARMS
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            D3231_Alarm1 a1;
+            DS3231_DecodeAlarm1(inputs.regs[i], &a1);
+            acc += a1.Seconds + a1.DayDate + a1.Mode;
+        }
+    bench_stop(&s);
+    bench_record("DecodeAlarm1", dist, &s, ops);
+#endif
+
+#if BENCH_HOST
+    reg_cursor = 0;
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            DS3231_DateTime dt;
+            DS3231_GetDateTime(&dt);
+            acc += dt.Date + dt.Second;
+        }
+    bench_stop(&s);
+    bench_record("GetDateTime", dist, &s, ops);
+
+    reg_cursor = 0;
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            D3231_Alarm1 a1;
+            DS3231_GetAlarm1(&a1);
+            acc += a1.Seconds + a1.DayDate + a1.Mode;
+        }
+    bench_stop(&s);
+    bench_record("GetAlarm1", dist, &s, ops);
+
+    reg_cursor = 0;
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++) {
+            DS3231_RawTime raw;
+            DS3231_GetRawTime(&raw);
+            acc += DS3231_RawTime_Minute(&raw);
+        }
+    bench_stop(&s);
+    bench_record("GetRawTimeMinute", dist, &s, ops);
+
+    bench_start(&s);
+    for (unsigned r = 0; r < rounds; r++)
+        for (unsigned i = 0; i < BENCH_INPUTS; i++)
+            acc += DS3231_SetDateTime(&inputs.dt[i]);
+    bench_stop(&s);
+    bench_record("SetDateTime", dist, &s, ops);
+#endif
+    sink += acc;
+}
+
+/*------------------------------------ REPORTING ------------------------------------------------*/
+static void bench_write_number(FILE *out, double value) {
+    if (value < 0)
+        fprintf(out, "null");
+    else
+        fprintf(out, "%.3f", value);
+}
+
+static void bench_write_json(FILE *out, unsigned rounds) {
+    fprintf(out, "{\n  \"suite\": \"conversions%s\",\n  \"inputs\": %u,\n  \"rounds\": %u,\n  \"results\": [\n",
+            DS3231_USE_INLINE ? "_inline" : "", BENCH_INPUTS, rounds);
+    for (unsigned i = 0; i < result_count; i++) {
+        fprintf(out, "    { \"name\": \"%s\", \"ns_per_op\": ", results[i].name);
+        bench_write_number(out, results[i].ns_per_op);
+        fprintf(out, ", \"instr_per_op\": ");
+        bench_write_number(out, results[i].instr_per_op);
+        fprintf(out, ", \"cycles_per_op\": ");
+        bench_write_number(out, results[i].cycles_per_op);
+        fprintf(out, " }%s\n", i + 1 < result_count ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+/**
+ * @brief Compares the results against "name max_ns_per_op [max_instr_per_op]" lines.
+ * @return Number of violated thresholds, or -1 when the file cannot be read.
+ */
+static int bench_check_thresholds(const char *path) {
+    char line[128];
+    int failures = 0;
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+        return -1;
+    while (fgets(line, sizeof(line), f)) {
+        char name[48];
+        double max_ns, max_instr = -1.0;
+        int fields = sscanf(line, "%47s %lf %lf", name, &max_ns, &max_instr);
+        if (fields < 2 || name[0] == '#')
+            continue;
+        for (unsigned i = 0; i < result_count; i++) {
+            if (strcmp(results[i].name, name) != 0)
+                continue;
+            if (results[i].ns_per_op > max_ns) {
+                fprintf(stderr, "FAIL %s: %.3f ns/op > %.3f\n", name, results[i].ns_per_op, max_ns);
+                failures++;
+            }
+            if (fields == 3 && results[i].instr_per_op >= 0 && results[i].instr_per_op > max_instr) {
+                fprintf(stderr, "FAIL %s: %.1f instr/op > %.1f\n", name, results[i].instr_per_op, max_instr);
+                failures++;
+            }
+        }
+    }
+    fclose(f);
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    const char *out_path = NULL, *threshold_path = NULL;
+    unsigned rounds = BENCH_DEFAULT_ROUNDS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            out_path = argv[++i];
+        else if (strcmp(argv[i], "--thresholds") == 0 && i + 1 < argc)
+            threshold_path = argv[++i];
+        else if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+            rounds = (unsigned) strtoul(argv[++i], NULL, 0);
+        else {
+            fprintf(stderr, "usage: %s [--out file.json] [--thresholds file] [--rounds N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    bench_timer_init();
+#if BENCH_HOST
+    HAL_Host_BindI2C(&bench_i2c, &bench_transport, NULL);
+    DS3231_Init(&bench_i2c);
+#endif
+
+    bench_fill_unix_uniform();
+    bench_derive_inputs();
+    bench_run("uniform", rounds);
+    bench_fill_unix_recent();
+    bench_derive_inputs();
+    bench_run("recent", rounds);
+    bench_fill_unix_edges();
+    bench_derive_inputs();
+    bench_run("edge", rounds);
+
+    for (unsigned i = 0; i < result_count; i++) {
+        printf("%-24s %10.2f ns/op", results[i].name, results[i].ns_per_op);
+        if (results[i].instr_per_op >= 0)
+            printf(" %10.1f instr/op", results[i].instr_per_op);
+        if (results[i].cycles_per_op >= 0)
+            printf(" %10.1f cycles/op", results[i].cycles_per_op);
+        printf("\n");
+    }
+
+    if (out_path) {
+        FILE *out = fopen(out_path, "w");
+        if (out == NULL) {
+            perror(out_path);
+            return 2;
+        }
+        bench_write_json(out, rounds);
+        fclose(out);
+    } else {
+        bench_write_json(stdout, rounds);
+    }
+
+    if (threshold_path) {
+        int failures = bench_check_thresholds(threshold_path);
+        if (failures < 0) {
+            perror(threshold_path);
+            return 2;
+        }
+        return failures ? 1 : 0;
+    }
+    return 0;
+}
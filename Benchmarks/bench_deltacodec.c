@@ -0,0 +1,175 @@
+/**
+ *  @brief     Compression ratio, speed and round trip check of the delta-of-delta timestamp codec.
+ *  @details   Encodes logger-like timestamp streams into 256 byte blocks, decodes them back, compares every
+ *             timestamp and times random access through #DS3231_DeltaFindBlock. Storage is reported against
+ *             a 4 byte unix time, 6 bytes with a fraction and a 16 byte #DS3231_DateTime per record. Exits with 1
+ *             if any timestamp does not survive the round trip.\n
+ *             bench_deltacodec [--records N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "DS3231.h"
+#include "DS3231_DeltaCodec.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BLOCK_SIZE      256             /* A typical flash page */
+#define UNIX_RECENT     1767225600UL    /* 2026-01-01 00:00:00 */
+
+typedef struct Workload {
+    const char *name;
+    uint8_t fraction_bits;
+    void (*fill)(DS3231_DeltaTime *t, size_t n);
+} Workload;
+
+static uint32_t rng_state = 0x9E3779B9UL;
+
+static uint32_t bench_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/*------------------------------------ WORKLOADS ------------------------------------------------*/
+/* 1 Hz sensor log from the RTC, one sample in a thousand is missed. */
+static void fill_1hz(DS3231_DeltaTime *t, size_t n) {
+    uint32_t s = UNIX_RECENT;
+    for (size_t i = 0; i < n; i++) {
+        s += 1 + (bench_rand() % 1000 == 0);
+        t[i].Seconds = s;
+        t[i].Fraction = 0;
+    }
+}
+
+/* 10 s cadence driven by a drifting MCU timer, stamped with whole RTC seconds. */
+static void fill_10s_jitter(DS3231_DeltaTime *t, size_t n) {
+    uint32_t s = UNIX_RECENT;
+    for (size_t i = 0; i < n; i++) {
+        s += 9 + bench_rand() % 3;
+        t[i].Seconds = s;
+        t[i].Fraction = 0;
+    }
+}
+
+/* 10 Hz samples with the fraction from a 1 kHz tick since the last RTC second, +-2 ms of scheduling jitter. */
+static void fill_10hz_fraction(DS3231_DeltaTime *t, size_t n) {
+    uint64_t ms = (uint64_t) UNIX_RECENT * 1000;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t at = ms + (uint64_t) i * 100 + (int64_t) (bench_rand() % 5) - 2;
+        t[i].Seconds = (uint32_t) (at / 1000);
+        t[i].Fraction = (uint16_t) ((at % 1000) * 65536 / 1000);
+    }
+}
+
+/* Irregular event log, gaps from a second to a few hours. */
+static void fill_events(DS3231_DeltaTime *t, size_t n) {
+    uint32_t s = UNIX_RECENT;
+    for (size_t i = 0; i < n; i++) {
+        s += 1U << (bench_rand() % 14);
+        t[i].Seconds = s;
+        t[i].Fraction = 0;
+    }
+}
+
+static const Workload workloads[] = {
+    { "1 Hz, whole seconds", 0, fill_1hz },
+    { "10 s +-1 s jitter", 0, fill_10s_jitter },
+    { "10 Hz, 1/1024 s fraction", 10, fill_10hz_fraction },
+    { "irregular events", 0, fill_events },
+};
+
+/*------------------------------------ RUN ------------------------------------------------------*/
+static int run(const Workload *w, size_t n) {
+    DS3231_DeltaTime *in = malloc(n * sizeof(*in));
+    uint8_t *blocks = malloc((n + 1) * BLOCK_SIZE);         /* Worst case a few records per block */
+    size_t count = 0, i, seeks = 100000, errors = 0;
+    DS3231_DeltaEncoder enc;
+    DS3231_DeltaDecoder dec;
+    uint64_t t0, enc_ns, dec_ns, seek_ns;
+    volatile uint32_t sink = 0;
+
+    if (in == NULL || blocks == NULL)
+        return 2;
+    w->fill(in, n);
+
+    t0 = now_ns();
+    DS3231_DeltaEncoder_Begin(&enc, blocks, BLOCK_SIZE, w->fraction_bits);
+    for (i = 0; i < n; i++) {
+        if (!DS3231_DeltaEncoder_Append(&enc, &in[i])) {
+            count++;
+            DS3231_DeltaEncoder_Begin(&enc, blocks + count * BLOCK_SIZE, BLOCK_SIZE, w->fraction_bits);
+            DS3231_DeltaEncoder_Append(&enc, &in[i]);
+        }
+    }
+    count++;
+    enc_ns = now_ns() - t0;
+
+    t0 = now_ns();
+    i = 0;
+    for (size_t b = 0; b < count; b++) {
+        DS3231_DeltaTime t;
+        DS3231_DeltaDecoder_Begin(&dec, blocks + b * BLOCK_SIZE, BLOCK_SIZE);
+        while (DS3231_DeltaDecoder_Next(&dec, &t)) {
+            uint16_t mask = (uint16_t) ~(0xFFFFU >> w->fraction_bits);
+            if (i >= n || t.Seconds != in[i].Seconds || t.Fraction != (in[i].Fraction & mask)) {
+                if (errors++ == 0)
+                    fprintf(stderr, "%s: record %zu decoded as %lu.%05u\n", w->name, i, (unsigned long) t.Seconds,
+                            t.Fraction);
+            }
+            i++;
+        }
+    }
+    dec_ns = now_ns() - t0;
+    errors += i != n;
+
+    /* Random access: find the block of a timestamp and decode up to it. */
+    t0 = now_ns();
+    for (size_t k = 0; k < seeks; k++) {
+        DS3231_DeltaTime target = in[bench_rand() % n], t;
+        size_t b = DS3231_DeltaFindBlock(blocks, count, BLOCK_SIZE, &target);
+        DS3231_DeltaDecoder_Begin(&dec, blocks + b * BLOCK_SIZE, BLOCK_SIZE);
+        while (DS3231_DeltaDecoder_Next(&dec, &t) && t.Seconds < target.Seconds)
+            ;
+        sink += t.Seconds;
+    }
+    seek_ns = now_ns() - t0;
+
+    printf("%-26s %7.3f %6.1fx %6.1fx %6.1fx %8.2f %8.2f %8.1f\n", w->name,
+           (double) count * BLOCK_SIZE / n, 4.0 * n / ((double) count * BLOCK_SIZE),
+           (w->fraction_bits ? 6.0 : 4.0) * n / ((double) count * BLOCK_SIZE),
+           16.0 * n / ((double) count * BLOCK_SIZE), (double) enc_ns / n, (double) dec_ns / n,
+           (double) seek_ns / seeks);
+    free(in);
+    free(blocks);
+    return errors ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    size_t records = 1000000;
+    int status = 0;
+
+    if (argc == 3 && strcmp(argv[1], "--records") == 0)
+        records = strtoul(argv[2], NULL, 0);
+    if (records == 0)
+        return 2;
+
+    printf("%zu records, %d byte blocks, sizes include block headers and unused tails\n\n", records, BLOCK_SIZE);
+    printf("%-26s %7s %7s %7s %7s %8s %8s %8s\n", "workload", "B/rec", "vs 4B", "vs raw", "vs 16B", "enc ns",
+           "dec ns", "seek ns");
+    for (unsigned w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++)
+        status |= run(&workloads[w], records);
+    return status;
+}
@@ -0,0 +1,194 @@
+/**
+ *  @brief     Correctness and throughput of the DS3231_Epoch converters.
+ *  @details   Checks every converter against plain division and modulo over a strided sweep of the uint32_t range
+ *             and at fixed reference points (GPS epoch, NTP era rollover, MJD/JD of the unix epoch), then times
+ *             the scalar and batch converters next to the division-based routines they replace. Exits with 1 on
+ *             any mismatch.\n
+ *             bench_epoch [--records N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "DS3231_Epoch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define UNIX_RECENT 1767225600UL        /* 2026-01-01 00:00:00 */
+
+static volatile uint64_t sink;
+static unsigned failures;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static void report(const char *name, uint64_t ns, size_t ops) {
+    printf("%-40s %8.2f ns/op\n", name, (double) ns / (double) ops);
+}
+
+static void check(int ok, const char *what, uint32_t value) {
+    if (!ok && failures++ < 10)
+        fprintf(stderr, "%s failed for %lu\n", what, (unsigned long) value);
+}
+
+/*------------------------------------ DIVISION REFERENCES --------------------------------------*/
+static DS3231_GpsTime ref_gps(uint32_t t, uint8_t tai_utc) {
+    uint32_t seconds = t - DS3231_EPOCH_UNIX_GPS + tai_utc - DS3231_EPOCH_TAI_GPS;
+    DS3231_GpsTime gps = { (uint16_t) (seconds / 604800UL), seconds % 604800UL };
+    return gps;
+}
+
+static uint32_t ref_mjd(uint32_t t, uint32_t *sod) {
+    *sod = t % 86400UL;
+    return t / 86400UL + 40587UL;
+}
+
+static void check_value(uint32_t t) {
+    DS3231_GpsTime gps = DS3231_Epoch_UnixToGPS(t, DS3231_EPOCH_TAI_UTC), ref = ref_gps(t, DS3231_EPOCH_TAI_UTC);
+    uint32_t sod, ref_sod, mjd = DS3231_Epoch_UnixToMJD(t, &sod);
+    uint64_t jd = DS3231_Epoch_UnixToJD(t), ntp = DS3231_Epoch_UnixToNTP((uint64_t) t << 32 | t);
+
+    check(gps.Week == ref.Week && gps.Tow == ref.Tow, "GPS week/TOW", t);
+    check(DS3231_Epoch_GPSToUnix(gps, DS3231_EPOCH_TAI_UTC) == t, "GPS round trip", t);
+    check(mjd == ref_mjd(t, &ref_sod) && sod == ref_sod, "MJD", t);
+    check(DS3231_Epoch_MJDToUnix(mjd, sod) == t, "MJD round trip", t);
+    check((uint32_t) (jd >> 32) == (uint32_t) (mjd + 2400001UL - (sod < 43200)), "JD day", t);
+    check(DS3231_Epoch_JDToUnix(jd) == t, "JD round trip", t);
+    check((uint32_t) (ntp >> 32) == (uint32_t) (t + 2208988800UL) && (uint32_t) ntp == t, "NTP", t);
+    check(DS3231_Epoch_NTPToUnix(ntp) == ((uint64_t) t << 32 | t), "NTP round trip", t);
+    check(DS3231_Epoch_TAIToUnix(DS3231_Epoch_UnixToTAI((uint64_t) t << 32, 37), 37) == (uint64_t) t << 32,
+          "TAI round trip", t);
+}
+
+int main(int argc, char **argv) {
+    size_t records = 1000000;
+    uint32_t *times, *out, *mjd, *sod;
+    uint64_t *wide, acc = 0, start;
+    DS3231_GpsTime *gps, epoch;
+    DS3231_DateTime *dt;
+
+    if (argc == 3 && strcmp(argv[1], "--records") == 0)
+        records = strtoul(argv[2], NULL, 0);
+    times = malloc(records * sizeof(*times));
+    out = malloc(records * sizeof(*out));
+    mjd = malloc(records * sizeof(*mjd));
+    sod = malloc(records * sizeof(*sod));
+    wide = malloc(records * sizeof(*wide));
+    gps = malloc(records * sizeof(*gps));
+    dt = malloc(records * sizeof(*dt));
+    if (!times || !out || !mjd || !sod || !wide || !gps || !dt)
+        return 2;
+    /* Fault the output pages in before timing. */
+    memset(out, 0, records * sizeof(*out));
+    memset(mjd, 0, records * sizeof(*mjd));
+    memset(sod, 0, records * sizeof(*sod));
+    memset(wide, 0, records * sizeof(*wide));
+    memset(gps, 0, records * sizeof(*gps));
+
+    /* Reference points. */
+    epoch = DS3231_Epoch_UnixToGPS(DS3231_EPOCH_UNIX_GPS, DS3231_EPOCH_TAI_GPS);
+    check(epoch.Week == 0 && epoch.Tow == 0, "GPS epoch", DS3231_EPOCH_UNIX_GPS);
+    epoch = DS3231_Epoch_UnixToGPS(1483228800UL, 37);          /* 2017-01-01, GPS - UTC = 18 s */
+    check(epoch.Week == 1930 && epoch.Tow == 18, "GPS 2017-01-01", 1483228800UL);
+    check((uint32_t) (DS3231_Epoch_UnixToNTP((uint64_t) 2085978496UL << 32) >> 32) == 0, "NTP era 1", 2085978496UL);
+    check(DS3231_Epoch_NTPToUnix(0) >> 32 == 2085978496UL, "NTP era 1 back", 0);
+    check(DS3231_Epoch_UnixToJD(0) == ((uint64_t) 2440587 << 32 | 0x80000001ULL), "JD of the unix epoch", 0);
+    check(DS3231_Epoch_UnixToMJD(0, &sod[0]) == 40587 && sod[0] == 0, "MJD of the unix epoch", 0);
+
+    /* Strided sweep of the whole range and every second of one day. */
+    for (uint64_t t = 0; t <= 0xFFFFFFFFULL; t += 65521)
+        check_value((uint32_t) t);
+    for (uint32_t t = UNIX_RECENT; t < UNIX_RECENT + 86400UL; t++)
+        check_value(t);
+    check_value(0xFFFFFFFFUL);
+
+    for (size_t i = 0; i < records; i++) {
+        times[i] = UNIX_RECENT + (uint32_t) ((i * 2654435761ULL) % (50 * 365 * 86400ULL));
+        DS3231_ToDateTime(&times[i], &dt[i]);
+    }
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        DS3231_GpsTime g = ref_gps(times[i], DS3231_EPOCH_TAI_UTC);
+        acc += g.Week + g.Tow;
+    }
+    report("GPS week/TOW, division", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        DS3231_GpsTime g = DS3231_Epoch_UnixToGPS(times[i], DS3231_EPOCH_TAI_UTC);
+        acc += g.Week + g.Tow;
+    }
+    report("DS3231_Epoch_UnixToGPS", now_ns() - start, records);
+
+    start = now_ns();
+    DS3231_Epoch_ToGPSBatch(times, DS3231_EPOCH_TAI_UTC, gps, (uint32_t) records);
+    report("DS3231_Epoch_ToGPSBatch", now_ns() - start, records);
+
+    start = now_ns();
+    DS3231_Epoch_FromGPSBatch(gps, DS3231_EPOCH_TAI_UTC, out, (uint32_t) records);
+    report("DS3231_Epoch_FromGPSBatch", now_ns() - start, records);
+    for (size_t i = 0; i < records; i++)
+        check(out[i] == times[i], "GPS batch round trip", times[i]);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        uint32_t s, m = ref_mjd(times[i], &s);
+        acc += m + s;
+    }
+    report("MJD, division", now_ns() - start, records);
+
+    start = now_ns();
+    DS3231_Epoch_ToMJDBatch(times, mjd, sod, (uint32_t) records);
+    report("DS3231_Epoch_ToMJDBatch", now_ns() - start, records);
+
+    start = now_ns();
+    DS3231_Epoch_ToJDBatch(times, wide, (uint32_t) records);
+    report("DS3231_Epoch_ToJDBatch", now_ns() - start, records);
+    for (size_t i = 0; i < records; i++)
+        check(DS3231_Epoch_JDToUnix(wide[i]) == times[i], "JD batch round trip", times[i]);
+
+    start = now_ns();
+    DS3231_Epoch_ToNTPBatch(times, wide, (uint32_t) records);
+    report("DS3231_Epoch_ToNTPBatch", now_ns() - start, records);
+
+    start = now_ns();
+    DS3231_Epoch_FromNTPBatch(wide, out, (uint32_t) records);
+    report("DS3231_Epoch_FromNTPBatch", now_ns() - start, records);
+    for (size_t i = 0; i < records; i++)
+        check(out[i] == times[i], "NTP batch round trip", times[i]);
+
+    start = now_ns();
+    DS3231_Epoch_ToTAIBatch(times, DS3231_EPOCH_TAI_UTC, wide, (uint32_t) records);
+    report("DS3231_Epoch_ToTAIBatch", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        uint32_t u = 0;
+        DS3231_ToUnixTime(&dt[i], &u);
+        DS3231_GpsTime g = DS3231_Epoch_UnixToGPS(u, DS3231_EPOCH_TAI_UTC);
+        acc += g.Week + g.Tow;
+    }
+    report("DS3231_DateTime to GPS via unix time", now_ns() - start, records);
+
+    sink = acc;
+    free(times);
+    free(out);
+    free(mjd);
+    free(sod);
+    free(wide);
+    free(gps);
+    free(dt);
+    if (failures) {
+        fprintf(stderr, "%u mismatch(es)\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ *  @brief     Bus cost and correctness of the cached FatFs timestamp provider.
+ *  @details   Drives #DS3231_GetFatTime against the simulator at a logger-like call rate, with jittered gaps,
+ *             and checks every returned word against the simulator's live registers. Reports transactions and
+ *             wire time per call next to a get_fattime() built on #DS3231_GetDateTime. Exits with 1 if any
+ *             returned timestamp was stale.\n
+ *             bench_fattime [--seconds N] [--rate calls_per_second]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231.h"
+#include "DS3231_FatTime.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !DS3231_USE_CACHE
+#error "bench_fattime measures the cache, build it with DS3231_USE_CACHE=1"
+#endif
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+static uint32_t rng_state = 0x2545F491UL;
+
+static uint32_t bench_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* What a get_fattime() on top of the broken down API costs. */
+static uint32_t fattime_from_datetime(void) {
+    DS3231_DateTime dt;
+    DS3231_GetDateTime(&dt);
+    return (uint32_t) (dt.Year - DS3231_FAT_EPOCH) << 25 | (uint32_t) dt.Month << 21 | (uint32_t) dt.Date << 16
+            | (uint32_t) dt.Hour_24mode << 11 | (uint32_t) dt.Minute << 5 | (uint32_t) dt.Second >> 1;
+}
+
+/* The simulator's time registers at this instant, read without going through the bus. */
+static uint32_t fattime_expected(void) {
+    return DS3231_FatTime_FromRaw(DS3231_RAWTIME(sim.Regs));
+}
+
+/* The bus takes time, so the second may legitimately roll over while a call is in flight. */
+static int fattime_current(uint32_t word, uint32_t before) {
+    return word == before || word == fattime_expected();
+}
+
+static void report(const char *name, uint32_t calls) {
+    uint32_t xfers = DS3231_BusCounter_Transactions(&counter);
+    printf("%-34s %8u %8u %10.3f %12.1f\n", name, (unsigned) calls, (unsigned) xfers, (double) xfers / calls,
+           DS3231_BusCounter_WireTime_ns(&counter, 400000) / 1000.0 / calls);
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = 60, rate = 300, calls, stale = 0;
+    DS3231_DateTime start = { DS3231_FRI, 16, 10, 2026, 23, 59, 30, DS3231_ENABLED };
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--seconds") == 0)
+            seconds = strtoul(argv[i + 1], NULL, 0);
+        else if (strcmp(argv[i], "--rate") == 0)
+            rate = strtoul(argv[i + 1], NULL, 0);
+    }
+    if (seconds == 0 || rate == 0)
+        return 2;
+    calls = seconds * rate;
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_Sim_SetBusClock(&sim, 400000);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start);
+    DS3231_Sim_Advance(&sim, 123456789ULL);         /* Put the second boundary away from a tick boundary */
+
+    printf("%-34s %8s %8s %10s %12s\n", "get_fattime source", "calls", "xfers", "xfers/call", "400k us/call");
+
+    DS3231_BusCounter_Reset(&counter);
+    for (uint32_t i = 0; i < calls; i++) {
+        uint32_t before = fattime_expected();
+        stale += !fattime_current(fattime_from_datetime(), before);
+        DS3231_Sim_Advance(&sim, (bench_rand() % (2000000000ULL / rate)));
+    }
+    report("DS3231_GetDateTime", calls);
+
+    DS3231_BusCounter_Reset(&counter);
+    for (uint32_t i = 0; i < calls; i++) {
+        uint32_t word, before;
+        if (i == calls / 2) {
+            /* Setting the clock must not be hidden by the cache. */
+            DS3231_SetDateTime(&start);
+            DS3231_BusCounter_Reset(&counter);
+        }
+        before = fattime_expected();
+        DS3231_GetFatTime(&word);
+        if (!fattime_current(word, before)) {
+            fprintf(stderr, "stale FAT time at call %u: got %08lx, expected %08lx\n", (unsigned) i,
+                    (unsigned long) word, (unsigned long) fattime_expected());
+            stale++;
+        }
+        DS3231_Sim_Advance(&sim, (bench_rand() % (2000000000ULL / rate)));
+    }
+    report("DS3231_GetFatTime (cached)", calls - calls / 2);
+
+    if (stale) {
+        fprintf(stderr, "%u stale timestamps\n", (unsigned) stale);
+        return 1;
+    }
+    return 0;
+}
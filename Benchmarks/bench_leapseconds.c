@@ -0,0 +1,200 @@
+/**
+ *  @brief     Correctness and lookup cost of the DS3231_LeapSeconds table.
+ *  @details   Parses leap-seconds.list text, checks the lookups against a linear scan over every leap second and
+ *             a sweep of the uint32_t range, checks that every inserted leap second converts to and from 23:59:60
+ *             and times lookups of a time stream in order and at random, cached against a binary search and a
+ *             linear scan on every call. With --list it also loads a leap-seconds.list file, e.g. the one of the
+ *             tz database. Exits with 1 on any mismatch.\n
+ *             bench_leapseconds [--records N] [--list path]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "DS3231_LeapSeconds.h"
+#include "DS3231_LeapFile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define UNIX_RECENT 1767225600UL        /* 2026-01-01 00:00:00 */
+
+/* Excerpt in the layout of leap-seconds.list, the data lines complete. */
+static const char list_text[] =
+    "#\tIn the following text, the symbol '#' introduces\n"
+    "#\ta comment, which continues from that symbol until\n"
+    "#\tthe end of the line.\n"
+    "#\n"
+    "#\tFile expires on 28 June 2027\n"
+    "#@\t4023129600\n"
+    "#\n"
+    "2272060800\t10\t# 1 Jan 1972\n2287785600\t11\t# 1 Jul 1972\n2303683200\t12\t# 1 Jan 1973\n"
+    "2335219200\t13\t# 1 Jan 1974\n2366755200\t14\t# 1 Jan 1975\n2398291200\t15\t# 1 Jan 1976\n"
+    "2429913600\t16\t# 1 Jan 1977\n2461449600\t17\t# 1 Jan 1978\n2492985600\t18\t# 1 Jan 1979\n"
+    "2524521600\t19\t# 1 Jan 1980\n2571782400\t20\t# 1 Jul 1981\n2603318400\t21\t# 1 Jul 1982\n"
+    "2634854400\t22\t# 1 Jul 1983\n2698012800\t23\t# 1 Jul 1985\n2776982400\t24\t# 1 Jan 1988\n"
+    "2840140800\t25\t# 1 Jan 1990\n2871676800\t26\t# 1 Jan 1991\n2918937600\t27\t# 1 Jul 1992\n"
+    "2950473600\t28\t# 1 Jul 1993\n2982009600\t29\t# 1 Jul 1994\n3029443200\t30\t# 1 Jan 1996\n"
+    "3076704000\t31\t# 1 Jul 1997\n3124137600\t32\t# 1 Jan 1999\n3345062400\t33\t# 1 Jan 2006\n"
+    "3439756800\t34\t# 1 Jan 2009\n3550089600\t35\t# 1 Jul 2012\n3644697600\t36\t# 1 Jul 2015\n"
+    "3692217600\t37\t# 1 Jan 2017\n";
+
+static volatile uint32_t sink;
+static unsigned failures;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static void report(const char *name, uint64_t ns, size_t ops) {
+    printf("%-44s %8.2f ns/op\n", name, (double) ns / (double) ops);
+}
+
+static void check(int ok, const char *what, uint32_t value) {
+    if (!ok && failures++ < 10)
+        fprintf(stderr, "%s failed for %lu\n", what, (unsigned long) value);
+}
+
+/* Reference: scan from the newest entry back. */
+static uint8_t linear(const DS3231_LeapTable *table, uint32_t unixtime) {
+    for (uint8_t i = table->Count; i > 0; i--) {
+        if (table->Entries[i - 1].Unix <= unixtime)
+            return table->Entries[i - 1].TaiUtc;
+    }
+    return table->Entries[0].TaiUtc;
+}
+
+/* The first entries of a loaded list are the built-in ones. */
+static int same_as_builtin(const DS3231_LeapFile *file) {
+    if (file->Count < DS3231_LEAP_BUILTIN_COUNT)
+        return 0;
+    for (uint8_t i = 0; i < DS3231_LEAP_BUILTIN_COUNT; i++) {
+        if (file->Entries[i].Unix != DS3231_LeapBuiltin[i].Unix
+                || file->Entries[i].TaiUtc != DS3231_LeapBuiltin[i].TaiUtc)
+            return 0;
+    }
+    return 1;
+}
+
+static void check_value(DS3231_LeapTable *table, uint32_t t) {
+    uint32_t back = 0;
+    const uint8_t offset = DS3231_Leap_TaiUtc(table, t);
+    check(offset == linear(table, t), "TAI - UTC", t);
+    if (t <= 0xFFFFFFFFUL - offset)
+        check(DS3231_Leap_FromTAI(table, t + offset, &back) == 0 && back == t, "TAI round trip", t);
+}
+
+static void check_leap_seconds(DS3231_LeapTable *table) {
+    for (uint8_t i = 1; i < table->Count; i++) {
+        const DS3231_LeapEntry *e = &table->Entries[i];
+        const uint32_t tai = e->Unix + e->TaiUtc - 1;
+        uint32_t unixtime = 0, back = 0;
+        DS3231_DateTime dt;
+        check(DS3231_Leap_FromTAI(table, tai, &unixtime) == 1 && unixtime == e->Unix - 1, "leap second", tai);
+        DS3231_Leap_ToDateTime(table, tai, &dt);
+        check(dt.Hour_24mode == 23 && dt.Minute == 59 && dt.Second == 60 && dt.Date >= 30, "23:59:60", tai);
+        check(DS3231_Leap_FromDateTime(table, &dt, &back) == HAL_OK && back == tai, "23:59:60 round trip", tai);
+        DS3231_Leap_ToDateTime(table, tai + 1, &dt);
+        check(dt.Hour_24mode == 0 && dt.Minute == 0 && dt.Second == 0 && dt.Date == 1, "midnight after", tai);
+        DS3231_Leap_ToDateTime(table, tai - 1, &dt);
+        check(dt.Hour_24mode == 23 && dt.Second == 59, "23:59:59 before", tai);
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t records = 1000000;
+    const char *list_path = NULL;
+    DS3231_LeapTable table, parsed_table;
+    DS3231_LeapFile parsed;
+    DS3231_DateTime dt = { DS3231_SAT, 31, 12, 2016, 23, 59, 60, DS3231_ENABLED };
+    uint32_t *times, tai = 0, acc = 0;
+    uint64_t start;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--records") == 0)
+            records = strtoul(argv[i + 1], NULL, 0);
+        else if (strcmp(argv[i], "--list") == 0)
+            list_path = argv[i + 1];
+    }
+    times = malloc(records * sizeof(*times));
+    if (times == NULL)
+        return 2;
+
+    /* The parsed list matches the built-in table. */
+    check(DS3231_Leap_Init(&table, NULL, 0, 0) == HAL_OK, "built-in table", 0);
+    check(DS3231_LeapFile_Parse(&parsed, list_text, sizeof(list_text) - 1) == HAL_OK
+          && parsed.Count == DS3231_LEAP_BUILTIN_COUNT && parsed.Expires == DS3231_LEAP_BUILTIN_EXPIRES
+          && same_as_builtin(&parsed), "parse", 0);
+    check(DS3231_Leap_Init(&parsed_table, parsed.Entries, parsed.Count, parsed.Expires) == HAL_OK, "init", 0);
+    check(DS3231_LeapFile_Parse(&parsed, "2287785600 11\n2272060800 10\n", 28) == HAL_ERROR, "out of order", 0);
+    check(DS3231_LeapFile_Parse(&parsed, "#@ 4023129600\n", 14) == HAL_ERROR, "no entries", 0);
+    check(DS3231_LeapFile_Parse(&parsed, "2272060800 x\n", 13) == HAL_ERROR, "malformed", 0);
+    if (list_path != NULL) {
+        check(DS3231_LeapFile_Load(&parsed, list_path) == HAL_OK && same_as_builtin(&parsed), "load", 0);
+        printf("%s: %u entries, expires %lu\n", list_path, parsed.Count, (unsigned long) parsed.Expires);
+    }
+
+    /* Reference points and 23:59:60. */
+    check(DS3231_Leap_TaiUtc(&table, 0) == 10 && DS3231_Leap_TaiUtc(&table, UNIX_RECENT) == 37, "offsets", 0);
+    check(DS3231_Leap_FromDateTime(&table, &dt, &tai) == HAL_OK && tai == 1483228800UL + 36, "2016-12-31 23:59:60",
+          tai);
+    dt.Date = 30;
+    check(DS3231_Leap_FromDateTime(&table, &dt, &tai) == HAL_ERROR, "23:59:60 without a leap second", 0);
+    check(DS3231_Leap_Expired(&table, DS3231_LEAP_BUILTIN_EXPIRES) && !DS3231_Leap_Expired(&table, UNIX_RECENT),
+          "expiry", 0);
+    if (DS3231_Leap_Expired(&table, (uint32_t) time(NULL)))
+        fprintf(stderr, "warning: the built-in leap second table has expired, refresh it from leap-seconds.list\n");
+    check_leap_seconds(&table);
+
+    /* Sweep of the range and around every entry, out of order for the cache. */
+    for (uint64_t t = 0; t <= 0xFFFFFFFFULL; t += 65521)
+        check_value(&table, (uint32_t) t);
+    for (uint8_t i = 0; i < table.Count; i++) {
+        for (uint32_t t = table.Entries[i].Unix - 3; t != table.Entries[i].Unix + 3; t++)
+            check_value(&table, t);
+    }
+    check_value(&table, 0xFFFFFFFFUL);
+
+    /* A logger's time stream: one record a second. */
+    for (size_t i = 0; i < records; i++)
+        times[i] = UNIX_RECENT + (uint32_t) i;
+    start = now_ns();
+    for (size_t i = 0; i < records; i++)
+        acc += DS3231_Leap_TaiUtc(&table, times[i]);
+    report("in order, cached segment", now_ns() - start, records);
+    start = now_ns();
+    for (size_t i = 0; i < records; i++)
+        acc += DS3231_Leap_Seek(&table, times[i]);
+    report("in order, binary search every call", now_ns() - start, records);
+    start = now_ns();
+    for (size_t i = 0; i < records; i++)
+        acc += linear(&table, times[i]);
+    report("in order, linear scan", now_ns() - start, records);
+
+    /* Historic times at random. */
+    for (size_t i = 0; i < records; i++)
+        times[i] = (uint32_t) ((i * 2654435761ULL) % UNIX_RECENT);
+    start = now_ns();
+    for (size_t i = 0; i < records; i++)
+        acc += DS3231_Leap_TaiUtc(&table, times[i]);
+    report("random 1970..2026, cached segment", now_ns() - start, records);
+    start = now_ns();
+    for (size_t i = 0; i < records; i++)
+        acc += linear(&table, times[i]);
+    report("random 1970..2026, linear scan", now_ns() - start, records);
+    for (size_t i = 0; i < records; i++)
+        check(DS3231_Leap_TaiUtc(&table, times[i]) == linear(&table, times[i]), "random", times[i]);
+
+    sink = acc;
+    free(times);
+    if (failures) {
+        fprintf(stderr, "%u mismatch(es)\n", failures);
+        return 1;
+    }
+    return 0;
+}
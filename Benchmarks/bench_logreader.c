@@ -0,0 +1,241 @@
+/**
+ *  @brief     Open and query latency of the mmap log reader on a large DS3231_Log file.
+ *  @details   Writes a log with the device side API (DS3231_Log.h): 4 KiB blocks, 16 byte records at 1 s
+ *             cadence with a gap every 1000 records, and a sparse index footer. The file is then evicted from
+ *             the page cache and opened with DS3231_LogReader_Open. Random time range queries are answered and
+ *             every result is checked against the known record times. Logs ending in a block torn by a power cut
+ *             must read up to that block. Exits with 1 on a wrong answer.\n
+ *             bench_logreader [--mb N] [--file path] [--queries N] [--no-footer] [--keep]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _GNU_SOURCE
+
+#include "DS3231.h"
+#include "DS3231_Log.h"
+#include "DS3231_LogReader.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BLOCK_SIZE      4096
+#define RECORD_SIZE     16
+#define INDEX_STRIDE    64
+#define UNIX_BASE       1767225600UL    /* 2026-01-01 00:00:00 */
+#define GAP_EVERY       1000            /* Records between gaps */
+#define GAP_SECONDS     5
+
+static uint32_t rng_state = 0x9E3779B9UL;
+static volatile size_t sink;
+
+static uint32_t bench_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static uint32_t record_time(uint64_t i) {
+    return (uint32_t) (UNIX_BASE + i + GAP_SECONDS * (i / GAP_EVERY));
+}
+
+/* First record index whose time is at or after t. */
+static uint64_t record_lower_bound(uint64_t records, uint32_t t) {
+    uint64_t lo = 0, hi = records;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (record_time(mid) < t)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static int write_log(const char *path, uint64_t blocks, int footer, uint64_t *records) {
+    static uint8_t block[BLOCK_SIZE];
+    uint8_t payload[RECORD_SIZE - 4] = { 0 };
+    uint8_t *index_buf = malloc(DS3231_LogIndex_Size((uint32_t) blocks, INDEX_STRIDE));
+    DS3231_LogBlock blk;
+    DS3231_LogIndex idx;
+    uint64_t i = 0;
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL || index_buf == NULL)
+        return 2;
+    DS3231_LogIndex_Begin(&idx, index_buf, DS3231_LogIndex_Size((uint32_t) blocks, INDEX_STRIDE), INDEX_STRIDE,
+                          BLOCK_SIZE);
+    for (uint64_t b = 0; b < blocks; b++) {
+        DS3231_LogBlock_Begin(&blk, block, BLOCK_SIZE, RECORD_SIZE, (uint32_t) b);
+        do {
+            DS3231_LogPut32(payload, (uint32_t) i);
+        } while (DS3231_LogBlock_Append(&blk, record_time(i), payload) && ++i);
+        DS3231_LogIndex_Add(&idx, block);
+        if (fwrite(block, BLOCK_SIZE, 1, f) != 1)
+            return 2;
+    }
+    if (footer && fwrite(index_buf, DS3231_LogIndex_Finish(&idx), 1, f) != 1)
+        return 2;
+    fclose(f);
+    free(index_buf);
+    *records = i;
+    return 0;
+}
+
+/* Blocks torn by a power cut: the reader must end the log before them instead of reading past the block. */
+static int check_torn(void) {
+    static uint8_t log[3 * BLOCK_SIZE];
+    static const struct {
+        uint16_t offset, value;
+    } tears[] = {
+        { DS3231_LOG_OFS_RECORDS, 0xFFFF },
+        { DS3231_LOG_OFS_RECORDS, (BLOCK_SIZE - DS3231_LOG_HEADER_SIZE) / RECORD_SIZE + 1 },
+        { DS3231_LOG_OFS_RECORD_SIZE, 0 },
+        { DS3231_LOG_OFS_RECORD_SIZE, 3 },
+        { DS3231_LOG_OFS_RECORD_SIZE, 0xFFFF },
+    };
+    uint8_t payload[RECORD_SIZE - 4] = { 0 };
+    DS3231_LogBlock blk;
+    DS3231_LogReader reader;
+    DS3231_LogCursor cursor;
+    uint64_t i = 0;
+    int errors = 0;
+
+    for (uint32_t b = 0; b < 3; b++) {
+        DS3231_LogBlock_Begin(&blk, &log[b * BLOCK_SIZE], BLOCK_SIZE, RECORD_SIZE, b);
+        while (DS3231_LogBlock_Append(&blk, record_time(i), payload))
+            i++;
+    }
+    for (size_t t = 0; t < sizeof(tears) / sizeof(tears[0]); t++) {
+        uint8_t *header = &log[2 * BLOCK_SIZE];
+        const uint16_t saved = DS3231_LogGet16(header + tears[t].offset);
+        size_t n = 0;
+        DS3231_LogPut16(header + tears[t].offset, tears[t].value);
+        if (DS3231_LogReader_OpenMemory(&reader, log, sizeof(log)) != HAL_OK || reader.Blocks != 2)
+            errors++;
+        DS3231_LogReader_Query(&reader, 0, 0xFFFFFFFFUL, &cursor);
+        while (DS3231_LogCursor_Next(&cursor, NULL) != NULL)
+            n++;
+        if (n != 2 * ((BLOCK_SIZE - DS3231_LOG_HEADER_SIZE) / RECORD_SIZE))
+            errors++;
+        DS3231_LogPut16(header + tears[t].offset, saved);
+    }
+    if (errors)
+        fprintf(stderr, "%d torn block checks failed\n", errors);
+    return errors;
+}
+
+int main(int argc, char **argv) {
+    const char *path = "bench_logreader.bin";
+    uint64_t mb = 1024, queries = 10000, records, blocks, t0, open_ns, query_ns, seek_ns, returned = 0;
+    int footer = 1, keep = 0, errors = 0;
+    DS3231_LogReader reader;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--mb") == 0 && i + 1 < argc)
+            mb = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--file") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (strcmp(argv[i], "--queries") == 0 && i + 1 < argc)
+            queries = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--no-footer") == 0)
+            footer = 0;
+        else if (strcmp(argv[i], "--keep") == 0)
+            keep = 1;
+    }
+    blocks = mb * 1024 * 1024 / BLOCK_SIZE;
+    if (blocks == 0 || blocks > 0xFFFFFFFFULL)
+        return 2;
+    errors += check_torn();
+
+    t0 = now_ns();
+    if (write_log(path, blocks, footer, &records) != 0) {
+        perror(path);
+        return 2;
+    }
+    printf("wrote %s: %llu MiB, %llu blocks, %llu records, %s footer in %.1f s\n", path, (unsigned long long) mb,
+           (unsigned long long) blocks, (unsigned long long) records, footer ? "with" : "without",
+           (now_ns() - t0) / 1e9);
+
+    {
+        /* Start from a cold page cache as after a fresh pull. */
+        int fd = open(path, O_RDONLY);
+        if (fd >= 0) {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+    }
+
+    t0 = now_ns();
+    if (DS3231_LogReader_Open(&reader, path) != HAL_OK) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    open_ns = now_ns() - t0;
+    if (reader.Blocks != blocks) {
+        fprintf(stderr, "found %zu blocks, expected %llu\n", reader.Blocks, (unsigned long long) blocks);
+        errors++;
+    }
+
+    t0 = now_ns();
+    for (uint64_t q = 0; q < queries; q++) {
+        /* Windows of a second to an hour, sometimes starting inside a gap or outside the log. */
+        uint32_t from = record_time(bench_rand() % records) - bench_rand() % 8 + (q == 0 ? 0x40000000UL : 0);
+        uint32_t to = from + bench_rand() % 3600;
+        uint64_t first = record_lower_bound(records, from), last = record_lower_bound(records, to + 1);
+        uint64_t n = 0;
+        DS3231_LogCursor cursor;
+        const uint8_t *record;
+
+        DS3231_LogReader_Query(&reader, from, to, &cursor);
+        while ((record = DS3231_LogCursor_Next(&cursor, NULL)) != NULL) {
+            if (DS3231_LogGet32(record + 4) != first + n) {
+                errors++;
+                break;
+            }
+            n++;
+        }
+        if (n != last - first) {
+            if (errors++ == 0)
+                fprintf(stderr, "query [%lu, %lu]: %llu records, expected %llu\n", (unsigned long) from,
+                        (unsigned long) to, (unsigned long long) n, (unsigned long long) (last - first));
+        }
+        returned += n;
+    }
+    query_ns = now_ns() - t0;
+
+    /* Positioning alone, the part that depends on the log size. */
+    t0 = now_ns();
+    for (uint64_t q = 0; q < queries; q++) {
+        DS3231_LogCursor cursor;
+        DS3231_LogReader_Query(&reader, record_time(bench_rand() % records), 0xFFFFFFFFUL, &cursor);
+        sink += cursor.Block + cursor.Record;
+    }
+    seek_ns = now_ns() - t0;
+
+    printf("open (cold cache)       %10.3f ms\n", open_ns / 1e6);
+    printf("query, positioning only %10.2f us/query\n", seek_ns / 1e3 / queries);
+    printf("query + iterate         %10.2f us/query, %.0f records/query\n", query_ns / 1e3 / queries,
+           (double) returned / queries);
+
+    DS3231_LogReader_Close(&reader);
+    if (!keep)
+        unlink(path);
+    if (errors) {
+        fprintf(stderr, "%d wrong answers\n", errors);
+        return 1;
+    }
+    return 0;
+}
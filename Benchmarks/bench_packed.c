@@ -0,0 +1,184 @@
+/**
+ *  @brief     Footprint and conversion cost of #DS3231_Packed against #DS3231_DateTime and unix time.
+ *  @details   Exits with 1 if the registers unpacked in either hour mode do not pack back to the timestamp, or
+ *             if a year outside #DS3231_PACKED_EPOCH to #DS3231_PACKED_LAST_YEAR is packed. The records start in
+ *             2026, or at the epoch when that is later.\n
+ *             bench_packed [--records N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "DS3231.h"
+#include "DS3231_Packed.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define UNIX_RECENT 1767225600UL        /* 2026-01-01 00:00:00 */
+
+static volatile uint32_t sink;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static void report(const char *name, uint64_t ns, size_t ops) {
+    printf("%-34s %8.2f ns/op\n", name, (double) ns / (double) ops);
+}
+
+/* Field-wise ordering, what comparing two DS3231_DateTime values costs without a packed form. */
+static int compare_datetime(const DS3231_DateTime *a, const DS3231_DateTime *b) {
+    if (a->Year != b->Year)
+        return a->Year < b->Year ? -1 : 1;
+    if (a->Month != b->Month)
+        return a->Month < b->Month ? -1 : 1;
+    if (a->Date != b->Date)
+        return a->Date < b->Date ? -1 : 1;
+    if (a->Hour_24mode != b->Hour_24mode)
+        return a->Hour_24mode < b->Hour_24mode ? -1 : 1;
+    if (a->Minute != b->Minute)
+        return a->Minute < b->Minute ? -1 : 1;
+    return (a->Second > b->Second) - (a->Second < b->Second);
+}
+
+/* The first and last packed years, the years either side are refused, from a DS3231_DateTime and registers. */
+static unsigned check_range(void) {
+    static const uint16_t years[] = { DS3231_PACKED_EPOCH - 1, DS3231_PACKED_EPOCH, DS3231_PACKED_LAST_YEAR,
+            DS3231_PACKED_LAST_YEAR + 1, 2100 };
+    unsigned failures = 0;
+    for (unsigned i = 0; i < sizeof(years) / sizeof(years[0]); i++) {
+        DS3231_DateTime dt = { DS3231_MON, 1, 3, years[i], 12, 0, 0, DS3231_ENABLED }, back;
+        const HAL_StatusTypeDef expected = (years[i] >= DS3231_PACKED_EPOCH && years[i] <= DS3231_PACKED_LAST_YEAR)
+                ? HAL_OK : HAL_ERROR;
+        DS3231_Packed p = 0, q = 0;
+        uint8_t r[7];
+        if (DS3231_ToPacked(&dt, &p) != expected)
+            failures++;
+        if (years[i] < 2000 || years[i] > 2199)
+            continue;
+        DS3231_EncodeDateTime(&dt, DS3231_24H, r);
+        if (DS3231_PackRegisters(r, &q) != expected || (expected == HAL_OK && q != p))
+            failures++;
+        if (expected != HAL_OK)
+            continue;
+        /* Back to registers: from 2100 on the century bit is set and the year register holds year % 100. */
+        DS3231_FromPacked(&p, &back);
+        if (DS3231_UnpackRegisters(&p, DS3231_12H, r) != 0 || back.Year != years[i]
+            || (r[5] >> DS3231_CENTURY) != (years[i] >= 2100) || r[6] != DS3231_EncodeBCD(years[i] % 100))
+            failures++;
+    }
+    if (failures)
+        fprintf(stderr, "%u year range checks failed\n", failures);
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    size_t records = 1000000;
+    DS3231_DateTime *dt;
+    DS3231_Packed *packed;
+    uint8_t (*regs)[7];
+    DS3231_DateTime epoch = { DS3231_MON, 1, 1, DS3231_PACKED_EPOCH, 0, 0, 0, DS3231_ENABLED };
+    uint32_t t = UNIX_RECENT, acc = 0;
+    uint64_t start;
+    unsigned failures = check_range();
+
+    if (argc == 3 && strcmp(argv[1], "--records") == 0)
+        records = strtoul(argv[2], NULL, 0);
+    dt = malloc(records * sizeof(*dt));
+    packed = malloc(records * sizeof(*packed));
+    regs = malloc(records * sizeof(*regs));
+    if (dt == NULL || packed == NULL || regs == NULL)
+        return 2;
+
+    printf("sizeof(DS3231_DateTime) = %zu bytes, sizeof(DS3231_Packed) = %zu bytes\n", sizeof(DS3231_DateTime),
+           sizeof(DS3231_Packed));
+    printf("%zu records: %zu bytes as DS3231_DateTime, %zu bytes packed (%.1fx smaller)\n\n", records,
+           records * sizeof(DS3231_DateTime), records * sizeof(DS3231_Packed),
+           (double) sizeof(DS3231_DateTime) / sizeof(DS3231_Packed));
+
+    if (DS3231_PACKED_EPOCH > 2026)
+        DS3231_ToUnixTime(&epoch, &t);
+    for (size_t i = 0; i < records; i++) {
+        t += (uint32_t) (i * 2654435761UL) >> 24;     /* 0..255 s apart */
+        DS3231_ToDateTime(&t, &dt[i]);
+        if (DS3231_ToPacked(&dt[i], &packed[i]) != HAL_OK
+            || DS3231_UnpackRegisters(&packed[i], DS3231_24H, regs[i]) != 0) {
+            fprintf(stderr, "record %zu cannot be packed\n", i);
+            failures++;
+        }
+    }
+
+    /* Register round trip in both hour modes. */
+    for (size_t i = 0; i < records; i++) {
+        const DS3231_HourMode mode = (i & 1) ? DS3231_12H : DS3231_24H;
+        uint8_t r[7];
+        DS3231_Packed p;
+        if (DS3231_UnpackRegisters(&packed[i], mode, r) != 0 || DS3231_PackRegisters(r, &p) != HAL_OK
+            || p != packed[i] || DS3231_Hour_Mode(r[2]) != mode) {
+            fprintf(stderr, "register round trip failed for record %zu\n", i);
+            failures++;
+        }
+    }
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        DS3231_Packed p;
+        DS3231_ToPacked(&dt[i], &p);
+        acc += p;
+    }
+    report("DS3231_ToPacked", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        DS3231_DateTime d;
+        DS3231_FromPacked(&packed[i], &d);
+        acc += d.Date + d.Day;
+    }
+    report("DS3231_FromPacked", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        DS3231_Packed p;
+        DS3231_PackRegisters(regs[i], &p);
+        acc += p;
+    }
+    report("DS3231_PackRegisters", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        uint8_t r[7];
+        DS3231_UnpackRegisters(&packed[i], DS3231_24H, r);
+        acc += r[0] + r[4];
+    }
+    report("DS3231_UnpackRegisters", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 0; i < records; i++) {
+        uint32_t u;
+        DS3231_ToUnixTime(&dt[i], &u);
+        acc += u;
+    }
+    report("DS3231_ToUnixTime (reference)", now_ns() - start, records);
+
+    start = now_ns();
+    for (size_t i = 1; i < records; i++)
+        acc += packed[i - 1] < packed[i];
+    report("compare packed", now_ns() - start, records - 1);
+
+    start = now_ns();
+    for (size_t i = 1; i < records; i++)
+        acc += compare_datetime(&dt[i - 1], &dt[i]) < 0;
+    report("compare DS3231_DateTime fields", now_ns() - start, records - 1);
+
+    sink = acc;
+    free(dt);
+    free(packed);
+    free(regs);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,206 @@
+/**
+ *  @brief     ds3231::DS3231 class template against the C API on the simulator.
+ *  @details   Runs the same workload through the C API and through several policy selections of the template,
+ *             each from the same simulator state. Reports bus transactions per call and host time per workload
+ *             iteration. Exits with 1 unless every variant returns the same values and leaves the same register
+ *             file, the uncached variants issue exactly the transactions of the C API and the template sets and
+ *             reads years past 2099 as the C API does, and after Init on a board in 12 hour mode writes the time and
+ *             the alarm hours in that mode.\n
+ *             bench_template [--iterations N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231.hpp"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+/* The C API behind the template's member names. */
+struct CApi {
+    HAL_StatusTypeDef GetDateTime(DS3231_DateTime *dt) { return DS3231_GetDateTime(dt); }
+    HAL_StatusTypeDef GetTemperatureQuarters(int16_t *t) { return DS3231_GetTemperatureQuarters(t); }
+    HAL_StatusTypeDef SetAlarm1IntEn(DS3231_State s) { return DS3231_SetAlarm1IntEn(s); }
+    HAL_StatusTypeDef GetAlarm1IntEn(DS3231_State *s) { return DS3231_GetAlarm1IntEn(s); }
+    HAL_StatusTypeDef GetAlarm1Flag(DS3231_State *s) { return DS3231_GetAlarm1Flag(s); }
+    HAL_StatusTypeDef ClearAlarm1Flag() { return DS3231_ClearAlarm1Flag(); }
+    HAL_StatusTypeDef Set32kHzOutput(DS3231_State s) { return DS3231_Set32kHzOutput(s); }
+    HAL_StatusTypeDef SetBatterySquareWave(DS3231_State s) { return DS3231_SetBatterySquareWave(s); }
+    HAL_StatusTypeDef GetRateSelect(DS3231_Rate *r) { return DS3231_GetRateSelect(r); }
+    HAL_StatusTypeDef SetAlarm2(D3231_Alarm2 *a) { return DS3231_SetAlarm2(a); }
+};
+
+#define NUM_OPS 10
+static const char *const op_names[NUM_OPS] = { "GetDateTime", "GetTemperatureQuarters", "SetAlarm1IntEn",
+        "GetAlarm1IntEn", "GetAlarm1Flag", "ClearAlarm1Flag", "Set32kHzOutput", "SetBatterySquareWave",
+        "GetRateSelect", "SetAlarm2" };
+
+/* One call of each operation, i selects the arguments. Returns a digest of everything read back. */
+template <typename Device>
+static std::uint32_t run_op(Device &dev, int op, std::uint32_t i) {
+    DS3231_DateTime dt;
+    D3231_Alarm2 a2 = { (uint8_t) (i % 60), (uint8_t) (i % 24), 1, DS3231_A2_MATCH_M_H, DS3231_DISABLED };
+    int16_t temp = 0;
+    DS3231_State state = DS3231_DISABLED;
+    DS3231_Rate rate = DS3231_RATE_1HZ;
+    std::uint32_t status;
+    switch (op) {
+    case 0:
+        status = dev.GetDateTime(&dt);
+        return status ^ dt.Second ^ dt.Minute << 6 ^ dt.Hour_24mode << 12 ^ dt.Date << 17 ^ dt.Enable << 22;
+    case 1:
+        status = dev.GetTemperatureQuarters(&temp);
+        return status ^ (std::uint16_t) temp << 2;
+    case 2:
+        return dev.SetAlarm1IntEn((DS3231_State) (i & 1));
+    case 3:
+        status = dev.GetAlarm1IntEn(&state);
+        return status ^ state << 2;
+    case 4:
+        status = dev.GetAlarm1Flag(&state);
+        return status ^ state << 2;
+    case 5:
+        return dev.ClearAlarm1Flag();
+    case 6:
+        return dev.Set32kHzOutput((DS3231_State) (i >> 1 & 1));
+    case 7:
+        return dev.SetBatterySquareWave((DS3231_State) (i >> 2 & 1));
+    case 8:
+        status = dev.GetRateSelect(&rate);
+        return status ^ rate << 2;
+    default:
+        return dev.SetAlarm2(&a2);
+    }
+}
+
+struct Result {
+    std::uint32_t xfers[NUM_OPS];
+    std::uint32_t digest;
+    std::uint8_t regs[DS3231_SIM_NUM_REGS];
+    double ns_per_iteration;
+};
+
+template <typename Device>
+static void run(Device &dev, const DS3231_Sim &start, std::uint32_t iterations, Result *r) {
+    std::memset(r, 0, sizeof(*r));
+    sim = start;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < iterations; i++) {
+        for (int op = 0; op < NUM_OPS; op++) {
+            std::uint32_t before = DS3231_BusCounter_Transactions(&counter);
+            r->digest = r->digest * 31 + run_op(dev, op, i);
+            r->xfers[op] += DS3231_BusCounter_Transactions(&counter) - before;
+        }
+        DS3231_Sim_Advance(&sim, 250000000ULL);
+    }
+    r->ns_per_iteration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count()
+            / iterations;
+    std::memcpy(r->regs, sim.Regs, sizeof(r->regs));
+}
+
+int main(int argc, char **argv) {
+    std::uint32_t iterations = 100000;
+    int errors = 0;
+    DS3231_DateTime start_time = { DS3231_FRI, 16, 10, 2026, 23, 59, 30, DS3231_ENABLED };
+    DS3231_Sim start;
+    Result c_api, hal_bus, static_bus, cached;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--iterations") == 0)
+            iterations = std::strtoul(argv[i + 1], NULL, 0);
+    }
+    if (iterations == 0)
+        return 2;
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start_time);
+    start = sim;
+
+    CApi c;
+    ds3231::DS3231<ds3231::HalBus> dev_hal(ds3231::HalBus { &hi2c });
+    ds3231::DS3231<ds3231::StaticHalBus<&hi2c>> dev_static;
+    ds3231::DS3231<ds3231::HalBus, ds3231::ControlCache, std::mutex> dev_cached(ds3231::HalBus { &hi2c });
+
+    run(c, start, iterations, &c_api);
+    run(dev_hal, start, iterations, &hal_bus);
+    run(dev_static, start, iterations, &static_bus);
+    run(dev_cached, start, iterations, &cached);
+
+    std::printf("%-24s %9s %9s %9s %9s\n", "xfers/call", "C API", "HalBus", "Static", "Cached");
+    for (int op = 0; op < NUM_OPS; op++) {
+        std::printf("%-24s %9.2f %9.2f %9.2f %9.2f\n", op_names[op], (double) c_api.xfers[op] / iterations,
+                    (double) hal_bus.xfers[op] / iterations, (double) static_bus.xfers[op] / iterations,
+                    (double) cached.xfers[op] / iterations);
+        if (hal_bus.xfers[op] != c_api.xfers[op] || static_bus.xfers[op] != c_api.xfers[op]) {
+            std::fprintf(stderr, "%s: uncached template differs from the C API in transactions\n", op_names[op]);
+            errors++;
+        }
+    }
+    std::printf("%-24s %9.0f %9.0f %9.0f %9.0f\n", "host ns/iteration", c_api.ns_per_iteration,
+                hal_bus.ns_per_iteration, static_bus.ns_per_iteration, cached.ns_per_iteration);
+
+    const Result *variants[] = { &hal_bus, &static_bus, &cached };
+    for (const Result *r : variants) {
+        if (r->digest != c_api.digest || std::memcmp(r->regs, c_api.regs, sizeof(r->regs)) != 0) {
+            std::fprintf(stderr, "%s results differ from the C API\n", r == &cached ? "cached" : "uncached");
+            errors++;
+        }
+    }
+
+    /* Century bit and month-aware validation, shared with the C API. */
+    DS3231_DateTime dt = { DS3231_MON, 31, 2, 2150, 8, 30, 0, DS3231_ENABLED }, back = {};
+    if (dev_hal.SetDateTime(&dt) != HAL_ERROR) {
+        std::fprintf(stderr, "template SetDateTime accepted Feb 31\n");
+        errors++;
+    }
+    dt.Month = 6;
+    dt.Date = 15;
+    if (dev_hal.SetDateTime(&dt) != HAL_OK || DS3231_GetDateTime(&back) != HAL_OK || back.Year != 2150
+            || dev_hal.GetDateTime(&back) != HAL_OK || back.Year != 2150 || back.Month != 6) {
+        std::fprintf(stderr, "template does not round trip 2150\n");
+        errors++;
+    }
+
+    /* A board left in 12 hour mode: after Init the alarm hours and the time are written in it, as by the C API,
+       and the 8 PM alarm matches. */
+    D3231_Alarm1 a1 = { 0, 0, 20, 1, DS3231_A1_MATCH_S_M_H, DS3231_DISABLED };
+    D3231_Alarm2 a2 = { 0, 20, 1, DS3231_A2_MATCH_M_H, DS3231_DISABLED };
+    std::uint8_t c_regs[DS3231_REG_CONTROL];
+    dt = { DS3231_FRI, 16, 10, 2026, 19, 59, 59, DS3231_ENABLED };
+    sim = start;
+    sim.Regs[DS3231_REG_HOUR] = 0x68;
+    const DS3231_Sim twelve = sim;
+    DS3231_Init(&hi2c);
+    DS3231_SetAlarm1(&a1);
+    DS3231_SetAlarm2(&a2);
+    DS3231_SetDateTime(&dt);
+    std::memcpy(c_regs, sim.Regs, sizeof(c_regs));
+    sim = twelve;
+    ds3231::DS3231<ds3231::HalBus> dev_12h(ds3231::HalBus { &hi2c });
+    if (dev_12h.Init() != HAL_OK || dev_12h.SetAlarm1(&a1) != HAL_OK || dev_12h.SetAlarm2(&a2) != HAL_OK
+            || dev_12h.SetDateTime(&dt) != HAL_OK || std::memcmp(sim.Regs, c_regs, sizeof(c_regs)) != 0
+            || sim.Regs[DS3231_REG_A1_HOUR] != 0x68 || sim.Regs[DS3231_REG_A2_HOUR] != 0x68
+            || sim.Regs[DS3231_REG_HOUR] != 0x67) {
+        std::fprintf(stderr, "template does not write alarms and time in 12 hour mode\n");
+        errors++;
+    }
+    DS3231_Sim_AdvanceSeconds(&sim, 2);
+    if (!(sim.Regs[DS3231_REG_STATUS] & (1U << DS3231_A1F)) || !(sim.Regs[DS3231_REG_STATUS] & (1U << DS3231_A2F))) {
+        std::fprintf(stderr, "template alarms set in 12 hour mode do not match\n");
+        errors++;
+    }
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,220 @@
+/**
+ *  @brief     Accuracy and cost of DS3231_TickMap on the simulator.
+ *  @details   A 32-bit 168 MHz cycle counter with a 37 ppm offset and a slow +-5 ppm wander runs next to the
+ *             simulated RTC and wraps every 25.6 s. Events are captured as bare counter values and resolved in
+ *             batches every 100 ms, once with anchors taken on the exact 1 Hz edges (SQW interrupt) and once with
+ *             #DS3231_TickMap_Poll every 2 ms. Every result is compared with the simulator's time, next to the
+ *             ad-hoc conversion with the nominal frequency from the newest anchor. Then the host cost of resolving
+ *             batches in capture order and shuffled is measured on a full map. Exits with 1 if the edge anchored
+ *             error exceeds 1 us or the polled one 2 ms.\n
+ *             bench_tickmap [--seconds N]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_TickMap.h"
+#include "DS3231_RawTime.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TICK_HZ         168000000.0
+#define OFFSET_PPM      37.0
+#define WANDER_PPM      5.0
+#define WANDER_PERIOD_S 300.0
+#define STEP_NS         2000000ULL      /* Poll period */
+#define BATCH_NS        100000000ULL    /* Resolve period */
+#define MAX_BATCH       1024
+#define COST_EVENTS     4000000UL
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+static uint64_t base_ns, base_unix_ns;     /* The simulator's unix time in ns at sim time base_ns */
+
+static uint32_t rng_state = 0x2545F491UL;
+
+static uint32_t bench_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* Counter value at a simulator time: the integral of the drifting frequency. */
+static uint32_t counter_at(uint64_t ns) {
+    const double t = ns / 1e9, w = 2 * M_PI / WANDER_PERIOD_S;
+    const double phase = TICK_HZ * (t * (1 + OFFSET_PPM * 1e-6) + WANDER_PPM * 1e-6 * (1 - cos(w * t)) / w);
+    return (uint32_t) (uint64_t) phase;
+}
+
+static uint32_t read_tick(void) {
+    return counter_at(DS3231_Sim_Now(&sim));
+}
+
+static uint64_t to_ns(uint64_t time) {
+    return DS3231_TICKMAP_SECONDS(time) * 1000000000ULL + ((DS3231_TICKMAP_FRACTION(time) * 1000000000ULL) >> 32);
+}
+
+static double host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+typedef struct Accuracy {
+    double max_error_us;
+    double max_nominal_us;
+    uint32_t events, anchors;
+    uint32_t xfers;
+} Accuracy;
+
+/* Runs the simulated board for the given time, polled selects the anchoring. */
+static int run(uint32_t seconds, int polled, DS3231_TickMap *map, Accuracy *acc) {
+    static uint32_t ticks[MAX_BATCH];
+    static uint64_t truth[MAX_BATCH], times[MAX_BATCH];
+    const uint64_t end = DS3231_Sim_Now(&sim) + seconds * 1000000000ULL;
+    uint64_t next_batch = DS3231_Sim_Now(&sim) + BATCH_NS;
+    uint64_t next_edge = base_ns + (1000000000ULL - base_unix_ns % 1000000000ULL);
+    const DS3231_TickAnchor *newest;
+    uint32_t pending = 0;
+
+    memset(acc, 0, sizeof(*acc));
+    DS3231_TickMap_Init(map, (uint32_t) TICK_HZ, 32);
+    DS3231_BusCounter_Reset(&counter);
+    while (DS3231_Sim_Now(&sim) < end) {
+        const uint64_t t0 = DS3231_Sim_Now(&sim);
+        /* Up to three events in this step, captured in order. */
+        uint32_t n = bench_rand() % 4;
+        uint64_t at = t0;
+        for (uint32_t i = 0; i < n && pending < MAX_BATCH; i++) {
+            at += bench_rand() % (STEP_NS / 4);
+            ticks[pending] = counter_at(at);
+            truth[pending] = base_unix_ns + (at - base_ns);
+            pending++;
+        }
+        if (polled) {
+            DS3231_Sim_Advance(&sim, STEP_NS - (DS3231_Sim_Now(&sim) - t0));
+            DS3231_TickMap_Poll(map, read_tick, (uint32_t) (3 * STEP_NS * TICK_HZ / 1e9));
+        } else {
+            DS3231_Sim_Advance(&sim, STEP_NS);
+            while (next_edge <= DS3231_Sim_Now(&sim)) {
+                uint32_t second = (uint32_t) ((base_unix_ns + (next_edge - base_ns)) / 1000000000ULL);
+                DS3231_TickMap_AddAnchor(map, counter_at(next_edge), DS3231_TICKMAP_TIME(second, 0));
+                acc->anchors++;
+                next_edge += 1000000000ULL;
+            }
+        }
+        if (DS3231_Sim_Now(&sim) >= next_batch) {
+            next_batch += BATCH_NS;
+            if (DS3231_TickMap_Resolve(map, read_tick(), ticks, times, pending) != HAL_OK) {
+                pending = 0;
+                continue;
+            }
+            newest = &map->Anchors[(map->Head + map->Count - 1) % DS3231_TICKMAP_ANCHORS];
+            for (uint32_t i = 0; i < pending && map->Count >= 2; i++) {
+                double error = fabs((double) (int64_t) (to_ns(times[i]) - truth[i])) / 1000.0;
+                /* Ad hoc: the newest anchor and the nominal frequency. */
+                double nominal = to_ns(newest->Time)
+                        + (double) (int32_t) (ticks[i] - (uint32_t) newest->Tick) * (1e9 / TICK_HZ);
+                double nominal_error = fabs(nominal - (double) truth[i]) / 1000.0;
+                if (error > acc->max_error_us)
+                    acc->max_error_us = error;
+                if (nominal_error > acc->max_nominal_us)
+                    acc->max_nominal_us = nominal_error;
+            }
+            acc->events += map->Count >= 2 ? pending : 0;
+            pending = 0;
+        }
+    }
+    if (polled)
+        acc->anchors = map->Count;
+    acc->xfers = DS3231_BusCounter_Transactions(&counter);
+    return 0;
+}
+
+static double resolve_cost(DS3231_TickMap *map, int shuffled) {
+    static uint32_t ticks[MAX_BATCH];
+    static uint64_t times[MAX_BATCH];
+    const DS3231_TickAnchor *oldest = &map->Anchors[map->Head];
+    const uint32_t span = (uint32_t) (map->LastTick - oldest->Tick);
+    uint64_t sink = 0;
+    double t0;
+    for (uint32_t i = 0; i < MAX_BATCH; i++)
+        ticks[i] = (uint32_t) (oldest->Tick + (uint64_t) span * i / MAX_BATCH);
+    if (shuffled) {
+        for (uint32_t i = MAX_BATCH - 1; i > 0; i--) {
+            uint32_t j = bench_rand() % (i + 1), t = ticks[i];
+            ticks[i] = ticks[j];
+            ticks[j] = t;
+        }
+    }
+    t0 = host_ns();
+    for (uint32_t done = 0; done < COST_EVENTS; done += MAX_BATCH) {
+        DS3231_TickMap_Resolve(map, map->LastRaw, ticks, times, MAX_BATCH);
+        sink += times[done % MAX_BATCH];
+    }
+    return (host_ns() - t0) / COST_EVENTS + (sink == 1 ? 1 : 0);
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = 120;
+    DS3231_DateTime start = { DS3231_FRI, 16, 10, 2026, 23, 59, 30, DS3231_ENABLED };
+    DS3231_RawTime raw;
+    DS3231_DateTime dt;
+    uint32_t unixtime = 0;
+    static DS3231_TickMap edge_map, poll_map;
+    Accuracy edge, poll;
+    int errors = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--seconds") == 0)
+            seconds = strtoul(argv[i + 1], NULL, 0);
+    }
+    if (seconds < 10)
+        return 2;
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_Sim_SetBusClock(&sim, 400000);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start);
+    DS3231_Sim_Advance(&sim, 123456789ULL);
+
+    /* The simulator's clock is exact, one reading gives its time at every sim time. */
+    memcpy(raw.Regs, sim.Regs, sizeof(raw.Regs));
+    DS3231_RawTime_ToDateTime(&raw, &dt);
+    DS3231_ToUnixTime(&dt, &unixtime);
+    base_ns = DS3231_Sim_Now(&sim);
+    base_unix_ns = unixtime * 1000000000ULL + sim.SubSecond_ns;
+
+    run(seconds, 0, &edge_map, &edge);
+    run(seconds, 1, &poll_map, &poll);
+
+    printf("%-26s %8s %8s %8s %14s %16s\n", "anchors", "events", "anchors", "xfers", "max error us",
+           "nominal error us");
+    printf("%-26s %8u %8u %8u %14.3f %16.1f\n", "1 Hz edge (SQW)", (unsigned) edge.events, (unsigned) edge.anchors,
+           (unsigned) edge.xfers, edge.max_error_us, edge.max_nominal_us);
+    printf("%-26s %8u %8u %8u %14.3f %16.1f\n", "DS3231_TickMap_Poll 2 ms", (unsigned) poll.events,
+           (unsigned) poll.anchors, (unsigned) poll.xfers, poll.max_error_us, poll.max_nominal_us);
+    printf("resolve, %u anchors: %.1f ns/event in capture order, %.1f ns/event shuffled\n",
+           (unsigned) edge_map.Count, resolve_cost(&edge_map, 0), resolve_cost(&edge_map, 1));
+
+    if (edge.events == 0 || edge.max_error_us > 1.0) {
+        fprintf(stderr, "edge anchored error out of bounds\n");
+        errors++;
+    }
+    if (poll.events == 0 || poll.max_error_us > 2000.0) {
+        fprintf(stderr, "polled error out of bounds\n");
+        errors++;
+    }
+    return errors ? 1 : 0;
+}
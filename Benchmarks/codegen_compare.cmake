@@ -0,0 +1,74 @@
+# Compares the disassembly of direct_<name> and template_<name> in the codegen_template object.
+# The listing counts instructions plus relocations, i.e. calls and global accesses.
+#   cmake -DOBJDUMP=objdump -DOBJECT=codegen_template.o -DPAIRS=GetDateTime,... [-DEXTRA=cached_X,...] -P codegen_compare.cmake
+# Addresses, padding and comments are dropped, call targets are compared through their relocations.
+
+string(REPLACE "," ";" PAIRS "${PAIRS}")
+string(REPLACE "," ";" EXTRA "${EXTRA}")
+
+execute_process(COMMAND ${OBJDUMP} -dr --no-show-raw-insn ${OBJECT} OUTPUT_VARIABLE asm RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECT}")
+endif()
+
+string(REPLACE ";" "," asm "${asm}")
+string(REPLACE "[" "(" asm "${asm}")
+string(REPLACE "]" ")" asm "${asm}")
+string(REPLACE "\n" ";" lines "${asm}")
+
+set(current "")
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-f]+ <([A-Za-z_0-9]+)>:$")
+        set(current ${CMAKE_MATCH_1})
+        set(fn_${current} "")
+    elseif(current AND line MATCHES "^[ \t]*[0-9a-f]+:[ \t]+(R_[A-Za-z0-9_]+[ \t]+.*)$")
+        string(REGEX REPLACE "[ \t]+" " " reloc "${CMAKE_MATCH_1}")
+        list(APPEND fn_${current} "${reloc}")
+    elseif(current AND line MATCHES "^[ \t]*[0-9a-f]+:\t(.*)$")
+        set(insn "${CMAKE_MATCH_1}")
+        string(REGEX REPLACE "[ \t]*[#@].*$" "" insn "${insn}")
+        string(REGEX REPLACE "[0-9a-f]+ <[A-Za-z_0-9]+\\+(0x[0-9a-f]+)>" "<+\\1>" insn "${insn}")
+        string(REGEX REPLACE "[0-9a-f]+ <[A-Za-z_0-9]+>" "<+0>" insn "${insn}")
+        string(REGEX REPLACE "[ \t]+" " " insn "${insn}")
+        if(NOT insn MATCHES "^(nop|xchg %ax,%ax|data16|cs nop)")
+            list(APPEND fn_${current} "${insn}")
+        endif()
+    elseif(line STREQUAL "")
+        set(current "")
+    endif()
+endforeach()
+
+# A pair passes when the template makes the same calls with no more instructions. Identical code is the normal
+# result, the compiler may still lay out the blocks of two equivalent functions differently.
+set(failed 0)
+message("function                   direct  template")
+foreach(name IN LISTS PAIRS)
+    set(direct_calls ${fn_direct_${name}})
+    set(template_calls ${fn_template_${name}})
+    list(FILTER direct_calls INCLUDE REGEX "^R_")
+    list(FILTER template_calls INCLUDE REGEX "^R_")
+    list(LENGTH fn_direct_${name} direct)
+    list(LENGTH fn_template_${name} template)
+    if(direct EQUAL 0)
+        set(verdict "MISSING")
+        math(EXPR failed "${failed} + 1")
+    elseif(fn_direct_${name} STREQUAL fn_template_${name})
+        set(verdict "identical")
+    elseif(direct_calls STREQUAL template_calls AND NOT template GREATER direct)
+        set(verdict "same calls, block layout differs")
+    else()
+        set(verdict "PENALTY")
+        math(EXPR failed "${failed} + 1")
+    endif()
+    string(LENGTH "${name}" len)
+    math(EXPR pad "26 - ${len}")
+    string(REPEAT " " ${pad} spaces)
+    message("${name}${spaces} ${direct}      ${template}      ${verdict}")
+endforeach()
+foreach(name IN LISTS EXTRA)
+    list(LENGTH fn_${name} count)
+    message("${name}: ${count} instructions")
+endforeach()
+if(failed)
+    message(FATAL_ERROR "${failed} template functions cost more than the hand written HAL calls")
+endif()
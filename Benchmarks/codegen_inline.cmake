@@ -0,0 +1,117 @@
+# Compares DS3231.c built with DS3231_USE_INLINE=0 and =1 at -Os, one object each, for the listed functions.
+#   cmake -DOBJDUMP=objdump -DOUT_OF_LINE=a.o -DINLINE=b.o -DFUNCTIONS=DS3231_GetDateTime,... -P codegen_inline.cmake
+# A function's instructions include those of every helper it calls in the same object, once per call site, so a
+# helper that is inlined and one that is called are counted alike. Calls that end in an undefined symbol are the
+# I2C transaction: they are listed as bus calls and not expanded, they are the same in both builds.
+# The inline build passes when it makes fewer helper calls for no more instructions.
+
+cmake_policy(VERSION 3.16)
+
+string(REPLACE "," ";" FUNCTIONS "${FUNCTIONS}")
+
+# Sets <prefix>_defined and, per function, <prefix>_<fn>_count and <prefix>_<fn>_callees in the caller's scope.
+function(ds3231_parse object prefix)
+    execute_process(COMMAND ${OBJDUMP} -dr --no-show-raw-insn ${object} OUTPUT_VARIABLE asm RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} failed on ${object}")
+    endif()
+    string(REPLACE ";" "," asm "${asm}")
+    string(REPLACE "[" "(" asm "${asm}")
+    string(REPLACE "]" ")" asm "${asm}")
+    string(REPLACE "\n" ";" lines "${asm}")
+
+    set(defined "")
+    set(current "")
+    set(branch OFF)
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^[0-9a-f]+ <([A-Za-z_0-9]+)>:$")
+            set(current ${CMAKE_MATCH_1})
+            list(APPEND defined ${current})
+            set(count_${current} 0)
+            set(callees_${current} "")
+        elseif(current AND line MATCHES "^[ \t]*[0-9a-f]+:[ \t]+R_[A-Za-z0-9_]+[ \t]+([.A-Za-z_0-9]+)")
+            # The relocation of a call or tail jump names its target, directly or through its section.
+            if(branch)
+                string(REGEX REPLACE "^\\.text\\." "" callee "${CMAKE_MATCH_1}")
+                list(APPEND callees_${current} ${callee})
+            endif()
+            set(branch OFF)
+        elseif(current AND line MATCHES "^[ \t]*[0-9a-f]+:\t(.*)$")
+            set(insn "${CMAKE_MATCH_1}")
+            if(insn MATCHES "^(nop|xchg %ax,%ax|data16|cs nop)")
+                continue()
+            endif()
+            math(EXPR count_${current} "${count_${current}} + 1")
+            set(branch OFF)
+            # A resolved call names another function, an unresolved one points into itself and is relocated.
+            if(insn MATCHES "^(call|jmp|bl|blx|b|b\\.w)[ \t]+[0-9a-f]+ <([A-Za-z_0-9]+)(\\+0x[0-9a-f]+)?>")
+                if(CMAKE_MATCH_2 STREQUAL current)
+                    set(branch ON)
+                else()
+                    list(APPEND callees_${current} ${CMAKE_MATCH_2})
+                endif()
+            endif()
+        elseif(line STREQUAL "")
+            set(current "")
+        endif()
+    endforeach()
+
+    set(${prefix}_defined ${defined} PARENT_SCOPE)
+    foreach(fn IN LISTS defined)
+        set(${prefix}_${fn}_count ${count_${fn}} PARENT_SCOPE)
+        set(${prefix}_${fn}_callees ${callees_${fn}} PARENT_SCOPE)
+    endforeach()
+endfunction()
+
+# Expands <fn> in the parsed object: sets total instructions, helper calls and bus calls in the caller's scope.
+function(ds3231_expand prefix fn out_insns out_calls out_bus)
+    set(insns ${${prefix}_${fn}_count})
+    set(calls 0)
+    set(bus 0)
+    foreach(callee IN LISTS ${prefix}_${fn}_callees)
+        if(NOT callee IN_LIST ${prefix}_defined)
+            math(EXPR bus "${bus} + 1")
+            continue()
+        endif()
+        ds3231_expand(${prefix} ${callee} callee_insns callee_calls callee_bus)
+        if(callee_bus)
+            math(EXPR bus "${bus} + 1")
+        else()
+            math(EXPR insns "${insns} + ${callee_insns}")
+            math(EXPR calls "${calls} + 1 + ${callee_calls}")
+        endif()
+    endforeach()
+    set(${out_insns} ${insns} PARENT_SCOPE)
+    set(${out_calls} ${calls} PARENT_SCOPE)
+    set(${out_bus} ${bus} PARENT_SCOPE)
+endfunction()
+
+ds3231_parse(${OUT_OF_LINE} outline)
+ds3231_parse(${INLINE} inline)
+
+set(failed 0)
+message("function                 instructions    helper calls    bus calls")
+message("                         -INLINE +INLINE -INLINE +INLINE")
+foreach(fn IN LISTS FUNCTIONS)
+    if(NOT fn IN_LIST outline_defined OR NOT fn IN_LIST inline_defined)
+        message("${fn} MISSING")
+        math(EXPR failed "${failed} + 1")
+        continue()
+    endif()
+    ds3231_expand(outline ${fn} outline_insns outline_calls outline_bus)
+    ds3231_expand(inline ${fn} inline_insns inline_calls inline_bus)
+    if(inline_calls LESS outline_calls AND NOT inline_insns GREATER outline_insns)
+        set(verdict "")
+    else()
+        set(verdict "  NO GAIN")
+        math(EXPR failed "${failed} + 1")
+    endif()
+    string(LENGTH "${fn}" len)
+    math(EXPR pad "24 - ${len}")
+    string(REPEAT " " ${pad} spaces)
+    message("${fn}${spaces} ${outline_insns}     ${inline_insns}     ${outline_calls}       ${inline_calls}       "
+            "${outline_bus}/${inline_bus}${verdict}")
+endforeach()
+if(failed)
+    message(FATAL_ERROR "${failed} functions gain nothing from DS3231_USE_INLINE=1")
+endif()
@@ -0,0 +1,108 @@
+/**
+ *  @brief     Code generated for ds3231::DS3231<StaticHalBus> next to hand written HAL calls.
+ *  @details   Each template_X function calls the class template with a static bus, no cache and no lock, each
+ *             direct_X function does the same job with HAL_I2C_Mem_Read/Write written out by hand. The
+ *             codegen_template test disassembles this object and fails unless every pair has identical
+ *             instructions. cached_X shows what ControlCache adds.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231.hpp"
+
+I2C_HandleTypeDef hi2c_codegen;
+
+using Device = ds3231::DS3231<ds3231::StaticHalBus<&hi2c_codegen>>;
+using CachedDevice = ds3231::DS3231<ds3231::StaticHalBus<&hi2c_codegen>, ds3231::ControlCache>;
+
+static CachedDevice cached;
+
+static inline uint8_t bcd(uint8_t bin) {
+    return (uint8_t) ((bin >> 4) * 10 + (bin & 0x0F));
+}
+
+extern "C" {
+
+HAL_StatusTypeDef template_GetDateTime(DS3231_DateTime *dt) {
+    return Device().GetDateTime(dt);
+}
+
+HAL_StatusTypeDef direct_GetDateTime(DS3231_DateTime *dt) {
+    uint8_t buffer[7], regSTATUS;
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Read(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_SECOND,
+            I2C_MEMADD_SIZE_8BIT, buffer, 7, DS3231_TIMEOUT);
+    if (status != HAL_OK)
+        return status;
+    dt->Second = bcd(buffer[0] & 0x7F);
+    dt->Minute = bcd(buffer[1] & 0x7F);
+    dt->Hour_24mode = DS3231_Hour_Decode(buffer[2]);
+    dt->Day = buffer[3] & 0x07;
+    dt->Date = bcd(buffer[4] & 0x3F);
+    dt->Month = bcd(buffer[5] & 0x1F);
+    dt->Year = (uint16_t) (bcd(buffer[6]) + 2000U + (buffer[5] >> DS3231_CENTURY) * 100U);
+    status = HAL_I2C_Mem_Read(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_STATUS, I2C_MEMADD_SIZE_8BIT, &regSTATUS,
+            1, DS3231_TIMEOUT);
+    if (status != HAL_OK)
+        return status;
+    dt->Enable = (regSTATUS & 0x80) ? DS3231_DISABLED : DS3231_ENABLED;
+    return status;
+}
+
+HAL_StatusTypeDef template_Set32kHzOutput(DS3231_State enable) {
+    return Device().Set32kHzOutput(enable);
+}
+
+HAL_StatusTypeDef direct_Set32kHzOutput(DS3231_State enable) {
+    uint8_t reg;
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Read(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_STATUS,
+            I2C_MEMADD_SIZE_8BIT, &reg, 1, DS3231_TIMEOUT);
+    if (status != HAL_OK)
+        return status;
+    reg = (uint8_t) ((reg & 0xF7) | (enable & 0x01) << DS3231_EN32KHZ);
+    return HAL_I2C_Mem_Write(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_STATUS, I2C_MEMADD_SIZE_8BIT, &reg, 1,
+            DS3231_TIMEOUT);
+}
+
+HAL_StatusTypeDef template_SetAlarm1IntEn(DS3231_State enable) {
+    return Device().SetAlarm1IntEn(enable);
+}
+
+HAL_StatusTypeDef direct_SetAlarm1IntEn(DS3231_State enable) {
+    uint8_t control;
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Read(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_CONTROL,
+            I2C_MEMADD_SIZE_8BIT, &control, 1, DS3231_TIMEOUT);
+    if (status != HAL_OK)
+        return status;
+    control = (uint8_t) ((control & 0xFE) | (enable & 0x01));
+    status = HAL_I2C_Mem_Write(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_CONTROL, I2C_MEMADD_SIZE_8BIT, &control, 1,
+            DS3231_TIMEOUT);
+    if (status != HAL_OK)
+        return status;
+    status = HAL_I2C_Mem_Read(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_CONTROL, I2C_MEMADD_SIZE_8BIT, &control, 1,
+            DS3231_TIMEOUT);
+    if (status != HAL_OK)
+        return status;
+    control |= 1 << DS3231_INTCN;
+    return HAL_I2C_Mem_Write(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_CONTROL, I2C_MEMADD_SIZE_8BIT, &control, 1,
+            DS3231_TIMEOUT);
+}
+
+HAL_StatusTypeDef template_GetTemperatureQuarters(int16_t *temp_quarters) {
+    return Device().GetTemperatureQuarters(temp_quarters);
+}
+
+HAL_StatusTypeDef direct_GetTemperatureQuarters(int16_t *temp_quarters) {
+    uint8_t buffer[2];
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Read(&hi2c_codegen, DS3231_I2C_ADDR, DS3231_REG_TEMP_MSB,
+            I2C_MEMADD_SIZE_8BIT, buffer, 2, DS3231_TIMEOUT);
+    if (status == HAL_OK)
+        *temp_quarters = (int16_t) ((int8_t) buffer[0] * 4 + (buffer[1] >> 6));
+    return status;
+}
+
+HAL_StatusTypeDef cached_SetAlarm1IntEn(DS3231_State enable) {
+    return cached.SetAlarm1IntEn(enable);
+}
+
+}
@@ -0,0 +1,37 @@
+/**
+ *  @brief     Counting I2C transport for measuring the bus cost of the DS3231 driver on the host.
+ *  @details   Sits between a host I2C handle and its transport, forwards every transfer and counts
+ *             transactions and bytes. Wire time is derived from the counts for any standard SCL rate,
+ *             including START/STOP, repeated START, bus free time and the address and register bytes.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_BUSCOUNTER_H
+#define DS3231_BUSCOUNTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+typedef struct DS3231_BusCounter {
+    const HAL_I2C_Transport *Inner;
+    void *InnerContext;
+    uint32_t Reads;             /* Register read transactions (write pointer, repeated START, read) */
+    uint32_t Writes;            /* Register write transactions */
+    uint32_t DataBytes;         /* Payload bytes only */
+    uint32_t WireBytes;         /* Every byte clocked on the bus including address and register bytes */
+} DS3231_BusCounter;
+
+void DS3231_BusCounter_Init(DS3231_BusCounter *bc, I2C_HandleTypeDef *hi2c);
+void DS3231_BusCounter_Reset(DS3231_BusCounter *bc);
+uint32_t DS3231_BusCounter_Transactions(const DS3231_BusCounter *bc);
+uint64_t DS3231_BusCounter_WireTime_ns(const DS3231_BusCounter *bc, uint32_t scl_hz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_BUSCOUNTER_H */
@@ -0,0 +1,36 @@
+/**
+ *  @brief     Host loader for the IETF leap-seconds.list file.
+ *  @details   Parses the list published by IERS and mirrored by NIST and the IANA tz database into entries for
+ *             DS3231_Leap_Init: data lines "<NTP seconds> <TAI - UTC> # comment" and the "#@ <NTP seconds>"
+ *             expiry line. Other "#" lines are comments. NTP times are converted to unix time.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_LEAPFILE_H
+#define DS3231_LEAPFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231_LeapSeconds.h"
+
+#include <stddef.h>
+
+#define DS3231_LEAPFILE_MAX     64
+
+typedef struct DS3231_LeapFile {
+    DS3231_LeapEntry Entries[DS3231_LEAPFILE_MAX];
+    uint8_t Count;
+    uint32_t Expires;           /* Unix time, 0 when the file has no "#@" line */
+} DS3231_LeapFile;
+
+HAL_StatusTypeDef DS3231_LeapFile_Load(DS3231_LeapFile *file, const char *path);
+HAL_StatusTypeDef DS3231_LeapFile_Parse(DS3231_LeapFile *file, const char *text, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_LEAPFILE_H */
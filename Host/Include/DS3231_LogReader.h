@@ -0,0 +1,54 @@
+/**
+ *  @brief     Host reader for DS3231_Log files.
+ *  @details   Maps a pulled log file read-only and answers time range queries with binary searches over the
+ *             sparse index footer, the block headers and the records of one block. Nothing is parsed or copied
+ *             up front, so opening a multi-GB log costs a handful of page faults. Records are returned as
+ *             pointers into the mapping.\n
+ *             Logs without a footer and logs ending in erased (0xFF) or unwritten blocks are accepted.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_LOGREADER_H
+#define DS3231_LOGREADER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231_Log.h"
+
+#include <stddef.h>
+
+typedef struct DS3231_LogReader {
+    const uint8_t *Data;        /* Start of the log */
+    size_t DataSize;
+    size_t MapSize;             /* Whole file, footer included */
+    int Fd;                     /* -1 when opened from memory */
+    uint32_t BlockSize;
+    size_t Blocks;              /* Valid blocks */
+    const uint8_t *Index;       /* Footer entries, NULL without a footer */
+    uint32_t IndexEntries;
+    uint32_t IndexStride;
+} DS3231_LogReader;
+
+typedef struct DS3231_LogCursor {
+    const DS3231_LogReader *Reader;
+    size_t Block;
+    uint32_t Record;
+    uint32_t To;                /* Last unix time to return */
+} DS3231_LogCursor;
+
+HAL_StatusTypeDef DS3231_LogReader_Open(DS3231_LogReader *reader, const char *path);
+HAL_StatusTypeDef DS3231_LogReader_OpenMemory(DS3231_LogReader *reader, const uint8_t *data, size_t size);
+void DS3231_LogReader_Close(DS3231_LogReader *reader);
+
+const uint8_t *DS3231_LogReader_Block(const DS3231_LogReader *reader, size_t block);
+void DS3231_LogReader_Query(const DS3231_LogReader *reader, uint32_t from, uint32_t to, DS3231_LogCursor *cursor);
+const uint8_t *DS3231_LogCursor_Next(DS3231_LogCursor *cursor, uint16_t *record_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_LOGREADER_H */
@@ -0,0 +1,70 @@
+/**
+ *  @brief     Behavioural host model of the DS3231 real-time clock IC.
+ *  @details   Models the 0x00-0x12 register file, the auto-incrementing register pointer with burst reads
+ *             and writes, timekeeping with 12/24 hour modes and the century bit, alarm matching per the
+ *             A1M/A2M mask bits, the CONV/BSY temperature conversion timing and the oscillator stop flag
+ *             across simulated power loss.\n
+ *             Time is virtual and only advances through #DS3231_Sim_Advance (or optionally with bus
+ *             traffic), so years of operation can be simulated in seconds.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_SIM_H
+#define DS3231_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+#define DS3231_SIM_NUM_REGS         0x13
+#define DS3231_SIM_NS_PER_S         1000000000ULL
+#define DS3231_SIM_CONV_TIME_NS     125000000ULL    /* Typical temperature conversion time, tCONV */
+#define DS3231_SIM_TCXO_PERIOD_S    64              /* Automatic TCXO conversion period */
+
+typedef enum DS3231_SimSupply {
+    DS3231_SIM_VCC,         /* Powered from VCC, I2C accessible */
+    DS3231_SIM_VBAT,        /* Running from the backup battery, I2C disabled */
+    DS3231_SIM_UNPOWERED    /* No supply at all, register contents are lost */
+} DS3231_SimSupply;
+
+typedef struct DS3231_Sim {
+    uint8_t Regs[DS3231_SIM_NUM_REGS];  /* Register file, time registers hold the live count */
+    uint8_t Pointer;                    /* Register pointer, auto-increments and wraps after 0x12 */
+    DS3231_SimSupply Supply;
+    uint64_t Now_ns;                    /* Virtual time since the model was created */
+    uint64_t SubSecond_ns;              /* Position inside the current second of the countdown chain */
+    uint64_t BusyUntil_ns;              /* End of the running temperature conversion */
+    uint8_t ConvPending;                /* A conversion is running and will update the temperature */
+    uint8_t TcxoCount;                  /* Seconds since the last automatic conversion */
+    int16_t Temperature;                /* Die temperature in 0.25 degree C steps */
+    uint32_t BusClock_Hz;               /* When non-zero every transaction advances time by its wire time */
+    uint32_t ReadTransactions;
+    uint32_t WriteTransactions;
+} DS3231_Sim;
+
+void DS3231_Sim_Init(DS3231_Sim *sim);
+void DS3231_Sim_Attach(DS3231_Sim *sim, I2C_HandleTypeDef *hi2c);
+
+void DS3231_Sim_Advance(DS3231_Sim *sim, uint64_t ns);
+void DS3231_Sim_AdvanceSeconds(DS3231_Sim *sim, uint32_t seconds);
+uint64_t DS3231_Sim_Now(const DS3231_Sim *sim);
+uint32_t DS3231_Sim_GetTick(void *sim);
+void DS3231_Sim_Delay(void *sim, uint32_t ms);
+
+void DS3231_Sim_SetSupply(DS3231_Sim *sim, DS3231_SimSupply supply);
+void DS3231_Sim_SetTemperature(DS3231_Sim *sim, int16_t quarter_degrees);
+void DS3231_Sim_SetBusClock(DS3231_Sim *sim, uint32_t hz);
+
+HAL_StatusTypeDef DS3231_Sim_Write(DS3231_Sim *sim, const uint8_t *bytes, uint16_t len);
+HAL_StatusTypeDef DS3231_Sim_Read(DS3231_Sim *sim, uint8_t *bytes, uint16_t len);
+
+extern const HAL_I2C_Transport DS3231_Sim_Transport;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_SIM_H */
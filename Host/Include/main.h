@@ -0,0 +1,68 @@
+/**
+ *  @brief     Host stand-in for the STM32Cube generated main.h.
+ *  @details   Declares the small subset of the STM32 HAL used by the DS3231 library so that it can be compiled
+ *             and run on a PC. I2C memory transfers are routed to a transport bound to the I2C handle, which
+ *             is how the simulator and the bus benchmarks plug in underneath Source/DS3231.c.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef MAIN_H
+#define MAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*---------------------------------------- HAL DEFINITIONS --------------------------------------*/
+#define HAL_MAX_DELAY           0xFFFFFFFFU
+#define I2C_MEMADD_SIZE_8BIT    0x00000001U
+#define I2C_MEMADD_SIZE_16BIT   0x00000010U
+
+typedef enum {
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+/*------------------------------------ HOST I2C TRANSPORT ---------------------------------------*/
+/**
+ * @brief Memory transfer hooks backing a host I2C handle.
+ * @details Both hooks describe one complete bus transaction: START, address, register, (repeated START,
+ * address,) data and STOP.
+ */
+typedef struct HAL_I2C_Transport {
+    HAL_StatusTypeDef (*MemWrite)(void *context, uint16_t DevAddress, uint16_t MemAddress, const uint8_t *pData,
+                                  uint16_t Size);
+    HAL_StatusTypeDef (*MemRead)(void *context, uint16_t DevAddress, uint16_t MemAddress, uint8_t *pData,
+                                 uint16_t Size);
+} HAL_I2C_Transport;
+
+typedef struct __I2C_HandleTypeDef {
+    const HAL_I2C_Transport *Transport;
+    void *Context;
+    uint32_t ErrorCode;
+} I2C_HandleTypeDef;
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+void HAL_Host_BindI2C(I2C_HandleTypeDef *hi2c, const HAL_I2C_Transport *transport, void *context);
+void HAL_Host_SetTickSource(uint32_t (*source)(void *context), void (*delay)(void *context, uint32_t ms),
+                            void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_H */
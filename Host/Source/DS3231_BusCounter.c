@@ -0,0 +1,100 @@
+/**
+ *  @brief     Counting I2C transport for measuring the bus cost of the DS3231 driver on the host.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_BusCounter.h"
+
+#include <string.h>
+
+static HAL_StatusTypeDef DS3231_BusCounter_MemWrite(void *context, uint16_t DevAddress, uint16_t MemAddress,
+                                                    const uint8_t *pData, uint16_t Size);
+static HAL_StatusTypeDef DS3231_BusCounter_MemRead(void *context, uint16_t DevAddress, uint16_t MemAddress,
+                                                   uint8_t *pData, uint16_t Size);
+
+static const HAL_I2C_Transport DS3231_BusCounter_Transport = { DS3231_BusCounter_MemWrite,
+                                                               DS3231_BusCounter_MemRead };
+
+/* I2C timing minimums from the UM10204 specification, in ns. */
+typedef struct DS3231_BusTiming {
+    uint32_t scl_hz;
+    uint32_t hd_sta;    /* START hold */
+    uint32_t su_sta;    /* Repeated START setup */
+    uint32_t su_sto;    /* STOP setup */
+    uint32_t buf;       /* Bus free time between STOP and the next START */
+} DS3231_BusTiming;
+
+static const DS3231_BusTiming DS3231_BusTimings[] = {
+    { 100000, 4000, 4700, 4000, 4700 },
+    { 400000, 600, 600, 600, 1300 },
+    { 1000000, 260, 260, 260, 500 },
+};
+
+/**
+ * @brief Wraps the transport currently bound to an I2C handle with a counter.
+ * @param[out] *bc Pass a pointer to a #DS3231_BusCounter structure.
+ * @param[in,out] *hi2c Host I2C handle, already bound to the device transport.
+ * @return void
+ */
+void DS3231_BusCounter_Init(DS3231_BusCounter *bc, I2C_HandleTypeDef *hi2c) {
+    memset(bc, 0, sizeof(*bc));
+    bc->Inner = hi2c->Transport;
+    bc->InnerContext = hi2c->Context;
+    HAL_Host_BindI2C(hi2c, &DS3231_BusCounter_Transport, bc);
+}
+
+/**
+ * @brief Clears all counters.
+ */
+void DS3231_BusCounter_Reset(DS3231_BusCounter *bc) {
+    bc->Reads = 0;
+    bc->Writes = 0;
+    bc->DataBytes = 0;
+    bc->WireBytes = 0;
+}
+
+/**
+ * @brief Returns the number of START ... STOP transactions issued.
+ */
+uint32_t DS3231_BusCounter_Transactions(const DS3231_BusCounter *bc) {
+    return bc->Reads + bc->Writes;
+}
+
+/**
+ * @brief Computes the time the counted traffic occupies the bus.
+ * @details Each byte takes nine SCL periods (eight bits and the acknowledge). Every transaction adds START
+ * hold, STOP setup and the bus free time, register reads add a repeated START.
+ * @param[in] *bc Pass a pointer to a #DS3231_BusCounter structure.
+ * @param[in] scl_hz SCL rate, timing minimums are taken from the next slower standard mode.
+ * @return Wire time in nanoseconds.
+ */
+uint64_t DS3231_BusCounter_WireTime_ns(const DS3231_BusCounter *bc, uint32_t scl_hz) {
+    const DS3231_BusTiming *t = &DS3231_BusTimings[0];
+    for (unsigned i = 0; i < sizeof(DS3231_BusTimings) / sizeof(DS3231_BusTimings[0]); i++)
+        if (scl_hz >= DS3231_BusTimings[i].scl_hz)
+            t = &DS3231_BusTimings[i];
+    uint64_t ns = (uint64_t) bc->WireBytes * 9 * 1000000000ULL / scl_hz;
+    ns += (uint64_t) (bc->Reads + bc->Writes) * (t->hd_sta + t->su_sto + t->buf);
+    ns += (uint64_t) bc->Reads * (t->su_sta + t->hd_sta);
+    return ns;
+}
+
+static HAL_StatusTypeDef DS3231_BusCounter_MemWrite(void *context, uint16_t DevAddress, uint16_t MemAddress,
+                                                    const uint8_t *pData, uint16_t Size) {
+    DS3231_BusCounter *bc = (DS3231_BusCounter*) context;
+    bc->Writes++;
+    bc->DataBytes += Size;
+    bc->WireBytes += 2 + Size;      // Address(W), register, data.
+    return bc->Inner->MemWrite(bc->InnerContext, DevAddress, MemAddress, pData, Size);
+}
+
+static HAL_StatusTypeDef DS3231_BusCounter_MemRead(void *context, uint16_t DevAddress, uint16_t MemAddress,
+                                                   uint8_t *pData, uint16_t Size) {
+    DS3231_BusCounter *bc = (DS3231_BusCounter*) context;
+    bc->Reads++;
+    bc->DataBytes += Size;
+    bc->WireBytes += 3 + Size;      // Address(W), register, address(R), data.
+    return bc->Inner->MemRead(bc->InnerContext, DevAddress, MemAddress, pData, Size);
+}
@@ -0,0 +1,102 @@
+/**
+ *  @brief     Host loader for the IETF leap-seconds.list file.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_LeapFile.h"
+#include "DS3231_Epoch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DS3231_LEAPFILE_LINE    256
+
+/*------------------------------------ HELPERS --------------------------------------------------*/
+/* NTP seconds of era 0 to unix time, 0 when out of the uint32_t unix range. */
+static uint32_t DS3231_LeapFile_Unix(const char *text, char **end) {
+    unsigned long long ntp = strtoull(text, end, 10);
+    if (*end == text || ntp < DS3231_EPOCH_NTP_UNIX || ntp - DS3231_EPOCH_NTP_UNIX > 0xFFFFFFFFULL)
+        return 0;
+    return (uint32_t) (ntp - DS3231_EPOCH_NTP_UNIX);
+}
+
+/* Parses one NUL terminated line. */
+static HAL_StatusTypeDef DS3231_LeapFile_Line(DS3231_LeapFile *file, const char *line) {
+    char *end, *digits;
+    unsigned long offset;
+    uint32_t unixtime;
+    while (*line == ' ' || *line == '\t')
+        line++;
+    if (line[0] == '#') {
+        if (line[1] == '@') {
+            file->Expires = DS3231_LeapFile_Unix(line + 2, &end);
+            return file->Expires ? HAL_OK : HAL_ERROR;
+        }
+        return HAL_OK;
+    }
+    if (line[0] == '\0' || line[0] == '\r')
+        return HAL_OK;
+    unixtime = DS3231_LeapFile_Unix(line, &digits);
+    offset = strtoul(digits, &end, 10);
+    if (unixtime == 0 || end == digits || offset > 0xFF || file->Count == DS3231_LEAPFILE_MAX)
+        return HAL_ERROR;
+    file->Entries[file->Count].Unix = unixtime;
+    file->Entries[file->Count].TaiUtc = (uint8_t) offset;
+    file->Count++;
+    return HAL_OK;
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+/**
+ * @brief Parses leap-seconds.list text.
+ * @param[out] *file Pass a pointer to #DS3231_LeapFile type variable.
+ * @param[in] *text File contents, need not be NUL terminated.
+ * @param[in] size Size of the text in bytes.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not. HAL_ERROR for a malformed line,
+ * more than #DS3231_LEAPFILE_MAX entries, no entries or entries out of order.
+ */
+HAL_StatusTypeDef DS3231_LeapFile_Parse(DS3231_LeapFile *file, const char *text, size_t size) {
+    char line[DS3231_LEAPFILE_LINE];
+    size_t pos = 0;
+    DS3231_LeapTable check;
+    file->Count = 0;
+    file->Expires = 0;
+    while (pos < size) {
+        const char *eol = memchr(text + pos, '\n', size - pos);
+        size_t length = eol ? (size_t) (eol - (text + pos)) : size - pos;
+        if (length >= sizeof(line))
+            return HAL_ERROR;
+        memcpy(line, text + pos, length);
+        line[length] = '\0';
+        if (DS3231_LeapFile_Line(file, line) != HAL_OK)
+            return HAL_ERROR;
+        pos += length + 1;
+    }
+    return DS3231_Leap_Init(&check, file->Entries, file->Count, file->Expires);
+}
+
+/**
+ * @brief Reads and parses a leap-seconds.list file.
+ * @param[out] *file Pass a pointer to #DS3231_LeapFile type variable.
+ * @param[in] *path File path, e.g. /usr/share/zoneinfo/leap-seconds.list.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_LeapFile_Load(DS3231_LeapFile *file, const char *path) {
+    HAL_StatusTypeDef status = HAL_ERROR;
+    FILE *f = fopen(path, "rb");
+    char *text;
+    long size;
+    if (f == NULL)
+        return HAL_ERROR;
+    if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+        text = malloc((size_t) size + 1);
+        if (text != NULL && fread(text, 1, (size_t) size, f) == (size_t) size)
+            status = DS3231_LeapFile_Parse(file, text, (size_t) size);
+        free(text);
+    }
+    fclose(f);
+    return status;
+}
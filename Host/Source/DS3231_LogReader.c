@@ -0,0 +1,229 @@
+/**
+ *  @brief     Host reader for DS3231_Log files.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _DEFAULT_SOURCE
+
+#include "DS3231_LogReader.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*------------------------------------ HELPERS --------------------------------------------------*/
+/* A block torn by a power cut may carry a header whose records do not fit, it ends the log like an empty one. */
+static int DS3231_LogReader_Valid(const DS3231_LogReader *reader, size_t block) {
+    const uint8_t *b = DS3231_LogReader_Block(reader, block);
+    const uint32_t records = DS3231_LogGet16(&b[DS3231_LOG_OFS_RECORDS]);
+    const uint32_t record_size = DS3231_LogGet16(&b[DS3231_LOG_OFS_RECORD_SIZE]);
+    return DS3231_LogGet32(&b[DS3231_LOG_OFS_MAGIC]) == DS3231_LOG_BLOCK_MAGIC
+            && DS3231_LogGet32(&b[DS3231_LOG_OFS_BLOCK_SIZE]) == reader->BlockSize
+            && records != 0 && record_size >= 4
+            && records * record_size <= reader->BlockSize - DS3231_LOG_HEADER_SIZE;
+}
+
+static uint32_t DS3231_LogReader_MaxTime(const DS3231_LogReader *reader, size_t block) {
+    return DS3231_LogGet32(DS3231_LogReader_Block(reader, block) + DS3231_LOG_OFS_MAX_TIME);
+}
+
+/* Locates the footer, the block size and the number of valid blocks. */
+static HAL_StatusTypeDef DS3231_LogReader_Scan(DS3231_LogReader *reader) {
+    const uint8_t *trailer;
+    size_t lo, hi;
+
+    reader->Index = NULL;
+    reader->IndexEntries = 0;
+    reader->IndexStride = 0;
+    if (reader->DataSize < DS3231_LOG_HEADER_SIZE)
+        return HAL_ERROR;
+    trailer = reader->Data + reader->DataSize - DS3231_LOG_TRAILER_SIZE;
+    if (reader->DataSize >= DS3231_LOG_TRAILER_SIZE && DS3231_LogGet32(trailer) == DS3231_LOG_INDEX_MAGIC) {
+        uint64_t footer = (uint64_t) DS3231_LogGet32(trailer + 4) * DS3231_LOG_ENTRY_SIZE + DS3231_LOG_TRAILER_SIZE;
+        if (footer <= reader->DataSize && DS3231_LogGet32(trailer + 8) != 0) {
+            reader->IndexEntries = DS3231_LogGet32(trailer + 4);
+            reader->IndexStride = DS3231_LogGet32(trailer + 8);
+            reader->Index = trailer - (size_t) reader->IndexEntries * DS3231_LOG_ENTRY_SIZE;
+            reader->DataSize -= (size_t) footer;
+        }
+    }
+    if (DS3231_LogGet32(reader->Data + DS3231_LOG_OFS_MAGIC) != DS3231_LOG_BLOCK_MAGIC)
+        return HAL_ERROR;
+    reader->BlockSize = DS3231_LogGet32(reader->Data + DS3231_LOG_OFS_BLOCK_SIZE);
+    if (reader->BlockSize < DS3231_LOG_HEADER_SIZE)
+        return HAL_ERROR;
+
+    /* Blocks are written front to back, find the first one that was not. */
+    reader->Blocks = reader->DataSize / reader->BlockSize;
+    lo = 0;
+    hi = reader->Blocks;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (DS3231_LogReader_Valid(reader, mid))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    reader->Blocks = lo;
+    return HAL_OK;
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+/**
+ * @brief Maps a log file read-only.
+ * @param[out] *reader Pass a pointer to #DS3231_LogReader type variable.
+ * @param[in] *path Log file path.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_LogReader_Open(DS3231_LogReader *reader, const char *path) {
+    struct stat st;
+    void *map;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return HAL_ERROR;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return HAL_ERROR;
+    }
+    map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return HAL_ERROR;
+    }
+    madvise(map, (size_t) st.st_size, MADV_RANDOM);
+    if (DS3231_LogReader_OpenMemory(reader, map, (size_t) st.st_size) != HAL_OK) {
+        munmap(map, (size_t) st.st_size);
+        close(fd);
+        return HAL_ERROR;
+    }
+    reader->Fd = fd;
+    return HAL_OK;
+}
+
+/**
+ * @brief Reads a log that is already in memory.
+ * @param[out] *reader Pass a pointer to #DS3231_LogReader type variable.
+ * @param[in] *data Pass a pointer to the log, it must stay valid while the reader is used.
+ * @param[in] size Log size in bytes.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_LogReader_OpenMemory(DS3231_LogReader *reader, const uint8_t *data, size_t size) {
+    reader->Data = data;
+    reader->DataSize = size;
+    reader->MapSize = size;
+    reader->Fd = -1;
+    return DS3231_LogReader_Scan(reader);
+}
+
+/**
+ * @brief Unmaps a log opened with #DS3231_LogReader_Open.
+ * @param[in] *reader Pass a pointer to #DS3231_LogReader type variable.
+ * @return void
+ */
+void DS3231_LogReader_Close(DS3231_LogReader *reader) {
+    if (reader->Fd < 0)
+        return;
+    munmap((void *) reader->Data, reader->MapSize);
+    close(reader->Fd);
+    reader->Fd = -1;
+}
+
+/**
+ * @brief Start of a block.
+ * @param[in] *reader Pass a pointer to #DS3231_LogReader type variable.
+ * @param[in] block Block number.
+ * @return Pointer into the log.
+ */
+const uint8_t *DS3231_LogReader_Block(const DS3231_LogReader *reader, size_t block) {
+    return reader->Data + block * reader->BlockSize;
+}
+
+/**
+ * @brief Positions a cursor on the first record at or after from.
+ * @details The footer narrows the search to one index stride, the block headers' max times to one block and the
+ * record times to one record, each with a binary search.
+ * @param[in] *reader Pass a pointer to #DS3231_LogReader type variable.
+ * @param[in] from First unix time of the range.
+ * @param[in] to Last unix time of the range, inclusive.
+ * @param[out] *cursor Pass a pointer to #DS3231_LogCursor type variable, read it with #DS3231_LogCursor_Next.
+ * @return void
+ */
+void DS3231_LogReader_Query(const DS3231_LogReader *reader, uint32_t from, uint32_t to, DS3231_LogCursor *cursor) {
+    size_t lo = 0, hi = reader->Blocks;
+    uint32_t rlo, rhi, record_size;
+    const uint8_t *block;
+
+    cursor->Reader = reader;
+    cursor->To = to;
+    cursor->Record = 0;
+    if (reader->Index != NULL && reader->IndexEntries > 0) {
+        /* Entries with a min time below from bound the start, the first one at or past from bounds the end. */
+        uint32_t elo = 0, ehi = reader->IndexEntries;
+        while (elo < ehi) {
+            uint32_t mid = elo + (ehi - elo) / 2;
+            if (DS3231_LogGet32(reader->Index + (size_t) mid * DS3231_LOG_ENTRY_SIZE) < from)
+                elo = mid + 1;
+            else
+                ehi = mid;
+        }
+        if (elo > 0)
+            lo = DS3231_LogGet32(reader->Index + (size_t) (elo - 1) * DS3231_LOG_ENTRY_SIZE + 4);
+        if (elo < reader->IndexEntries)
+            hi = DS3231_LogGet32(reader->Index + (size_t) elo * DS3231_LOG_ENTRY_SIZE + 4) + 1;
+        if (hi > reader->Blocks)
+            hi = reader->Blocks;
+        if (lo > hi)
+            lo = hi;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (DS3231_LogReader_MaxTime(reader, mid) < from)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    cursor->Block = lo;
+    if (lo >= reader->Blocks)
+        return;
+
+    block = DS3231_LogReader_Block(reader, lo);
+    record_size = DS3231_LogGet16(block + DS3231_LOG_OFS_RECORD_SIZE);
+    rlo = 0;
+    rhi = DS3231_LogGet16(block + DS3231_LOG_OFS_RECORDS);
+    while (rlo < rhi) {
+        uint32_t mid = rlo + (rhi - rlo) / 2;
+        if (DS3231_LogGet32(block + DS3231_LOG_HEADER_SIZE + mid * record_size) < from)
+            rlo = mid + 1;
+        else
+            rhi = mid;
+    }
+    cursor->Record = rlo;
+}
+
+/**
+ * @brief Returns the next record of a query.
+ * @param[in,out] *cursor Pass a pointer to #DS3231_LogCursor type variable.
+ * @param[out] *record_size Pass a pointer to receive the record size, may be NULL.
+ * @return Pointer to the record inside the log, its first 4 bytes are the unix time, NULL past the range.
+ */
+const uint8_t *DS3231_LogCursor_Next(DS3231_LogCursor *cursor, uint16_t *record_size) {
+    const DS3231_LogReader *reader = cursor->Reader;
+    while (cursor->Block < reader->Blocks) {
+        const uint8_t *block = DS3231_LogReader_Block(reader, cursor->Block);
+        uint16_t size = DS3231_LogGet16(block + DS3231_LOG_OFS_RECORD_SIZE);
+        if (cursor->Record < DS3231_LogGet16(block + DS3231_LOG_OFS_RECORDS)) {
+            const uint8_t *record = block + DS3231_LOG_HEADER_SIZE + cursor->Record * size;
+            if (DS3231_LogGet32(record) > cursor->To)
+                return NULL;
+            cursor->Record++;
+            if (record_size != NULL)
+                *record_size = size;
+            return record;
+        }
+        cursor->Block++;
+        cursor->Record = 0;
+    }
+    return NULL;
+}
@@ -0,0 +1,85 @@
+/**
+ *  @brief     Host implementation of the STM32 HAL subset declared in Host/Include/main.h.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "main.h"
+
+#include <time.h>
+
+static uint32_t HAL_Host_MonotonicTick(void *context);
+static void HAL_Host_SleepDelay(void *context, uint32_t ms);
+
+static uint32_t (*tick_source)(void *context) = HAL_Host_MonotonicTick;
+static void (*tick_delay)(void *context, uint32_t ms) = HAL_Host_SleepDelay;
+static void *tick_context;
+
+/**
+ * @brief Binds a transport to a host I2C handle.
+ * @param[out] *hi2c I2C handle later passed to the driver.
+ * @param[in] *transport Memory transfer hooks to route the HAL calls to.
+ * @param[in] *context Opaque pointer passed back to the hooks.
+ * @return void
+ */
+void HAL_Host_BindI2C(I2C_HandleTypeDef *hi2c, const HAL_I2C_Transport *transport, void *context) {
+    hi2c->Transport = transport;
+    hi2c->Context = context;
+    hi2c->ErrorCode = 0;
+}
+
+/**
+ * @brief Replaces the time base behind HAL_GetTick() and HAL_Delay().
+ * @details A simulator passes its virtual clock here so that code polling HAL_GetTick() observes simulated
+ * time. Passing NULL restores the host monotonic clock.
+ * @param[in] source Returns the current tick in milliseconds.
+ * @param[in] delay Blocks (or advances virtual time) for the given number of milliseconds, may be NULL.
+ * @param[in] *context Opaque pointer passed back to both hooks.
+ * @return void
+ */
+void HAL_Host_SetTickSource(uint32_t (*source)(void *context), void (*delay)(void *context, uint32_t ms),
+                            void *context) {
+    tick_source = source ? source : HAL_Host_MonotonicTick;
+    tick_delay = source ? delay : HAL_Host_SleepDelay;
+    tick_context = context;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+    (void) Timeout;
+    if (hi2c == NULL || hi2c->Transport == NULL || MemAddSize != I2C_MEMADD_SIZE_8BIT)
+        return HAL_ERROR;
+    return hi2c->Transport->MemWrite(hi2c->Context, DevAddress, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+    (void) Timeout;
+    if (hi2c == NULL || hi2c->Transport == NULL || MemAddSize != I2C_MEMADD_SIZE_8BIT)
+        return HAL_ERROR;
+    return hi2c->Transport->MemRead(hi2c->Context, DevAddress, MemAddress, pData, Size);
+}
+
+uint32_t HAL_GetTick(void) {
+    return tick_source(tick_context);
+}
+
+void HAL_Delay(uint32_t Delay) {
+    if (tick_delay)
+        tick_delay(tick_context, Delay);
+}
+
+static uint32_t HAL_Host_MonotonicTick(void *context) {
+    struct timespec ts;
+    (void) context;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t) (ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000);
+}
+
+static void HAL_Host_SleepDelay(void *context, uint32_t ms) {
+    struct timespec ts = { ms / 1000, (long) (ms % 1000) * 1000000L };
+    (void) context;
+    nanosleep(&ts, NULL);
+}
@@ -0,0 +1,228 @@
+/**
+ *  @brief     Host tool that builds DS3231 register images and checks them against the simulator.
+ *  @details   make configures a simulated DS3231 through the driver API and exports its registers as an image.
+ *             check imports an image into a fresh simulator with a given elapsed time, compares every register
+ *             with what the image asks for, compares the advanced time with a second simulator that imported
+ *             the image and then ran for the elapsed time, and reports the bus cost of the import. Exits with 1
+ *             on an invalid image or any mismatch.\n
+ *             ds3231_image make [--time "YYYY-MM-DD HH:MM:SS" | --now] [--alarm1 HH:MM:SS] [--alarm2 HH:MM]
+ *                               [--sqw HZ] [--32khz 0|1] [--aging N] [--regions MASK] -o FILE\n
+ *             ds3231_image check FILE [--elapsed SECONDS]\n
+ *             ds3231_image dump FILE
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Image.h"
+#include "DS3231_RawTime.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+static void usage(void) {
+    fprintf(stderr, "usage: ds3231_image make [--time \"YYYY-MM-DD HH:MM:SS\" | --now] [--alarm1 HH:MM:SS]\n"
+            "                         [--alarm2 HH:MM] [--sqw 1|1024|4096|8192] [--32khz 0|1] [--aging N]\n"
+            "                         [--regions MASK] -o FILE\n"
+            "       ds3231_image check FILE [--elapsed SECONDS]\n"
+            "       ds3231_image dump FILE\n");
+}
+
+static void attach(void) {
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+}
+
+static int load(const char *path, uint8_t *image) {
+    FILE *f = fopen(path, "rb");
+    size_t n;
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    n = fread(image, 1, DS3231_IMAGE_SIZE, f);
+    if (n != DS3231_IMAGE_SIZE || fgetc(f) != EOF) {
+        fprintf(stderr, "%s: not a %d byte image\n", path, DS3231_IMAGE_SIZE);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+    if (DS3231_Image_Check(image) != HAL_OK) {
+        fprintf(stderr, "%s: bad header, version or CRC\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static void print_image(const uint8_t *image) {
+    const uint8_t *regs = &image[DS3231_IMAGE_HEADER];
+    printf("version %u, regions 0x%02X, %u burst(s)\n", image[2], image[3], DS3231_Image_Bursts(image[3]));
+    printf("registers");
+    for (int reg = 0; reg < DS3231_IMAGE_REGS; reg++)
+        printf(" %02X", regs[reg]);
+    printf("\n");
+    if (image[3] & DS3231_IMAGE_TIME) {
+        DS3231_DateTime dt;
+        DS3231_RawTime_ToDateTime(DS3231_RAWTIME(regs), &dt);
+        printf("time %04u-%02u-%02u %02u:%02u:%02u, day %u\n", dt.Year, dt.Month, dt.Date, dt.Hour_24mode,
+               dt.Minute, dt.Second, dt.Day);
+    }
+}
+
+static int cmd_make(int argc, char **argv) {
+    const char *out = NULL;
+    uint8_t regions = DS3231_IMAGE_ALL, image[DS3231_IMAGE_SIZE];
+    DS3231_DateTime dt = { 0, 1, 1, 2000, 0, 0, 0, DS3231_ENABLED };
+    uint32_t unixtime = 946684800UL;
+    FILE *f;
+
+    attach();
+    for (int i = 0; i < argc; i++) {
+        unsigned a = 0, b = 0, c = 0, d = 0, e = 0, g = 0;
+        if (strcmp(argv[i], "--now") == 0) {
+            unixtime = (uint32_t) time(NULL);
+            continue;
+        }
+        if (i + 1 == argc) {
+            usage();
+            return 2;
+        }
+        if (strcmp(argv[i], "--time") == 0 && sscanf(argv[i + 1], "%u-%u-%u %u:%u:%u", &a, &b, &c, &d, &e, &g) == 6) {
+            DS3231_DateTime t = { 0, (uint8_t) c, (uint8_t) b, (uint16_t) a, (uint8_t) d, (uint8_t) e, (uint8_t) g,
+                    DS3231_ENABLED };
+            DS3231_ToUnixTime(&t, &unixtime);
+        } else if (strcmp(argv[i], "--alarm1") == 0 && sscanf(argv[i + 1], "%u:%u:%u", &a, &b, &c) == 3) {
+            D3231_Alarm1 alarm = { (uint8_t) c, (uint8_t) b, (uint8_t) a, 1, DS3231_A1_MATCH_S_M_H, DS3231_ENABLED };
+            DS3231_SetAlarm1(&alarm);
+        } else if (strcmp(argv[i], "--alarm2") == 0 && sscanf(argv[i + 1], "%u:%u", &a, &b) == 2) {
+            D3231_Alarm2 alarm = { (uint8_t) b, (uint8_t) a, 1, DS3231_A2_MATCH_M_H, DS3231_ENABLED };
+            DS3231_SetAlarm2(&alarm);
+        } else if (strcmp(argv[i], "--sqw") == 0) {
+            unsigned long hz = strtoul(argv[i + 1], NULL, 0);
+            DS3231_SetRateSelect(hz >= 8192 ? DS3231_RATE_8192HZ : hz >= 4096 ? DS3231_RATE_4096HZ
+                    : hz >= 1024 ? DS3231_RATE_1024HZ : DS3231_RATE_1HZ);
+            DS3231_SetInterruptMode(DS3231_SQUARE_WAVE_INTERRUPT);
+        } else if (strcmp(argv[i], "--32khz") == 0) {
+            DS3231_Set32kHzOutput(atoi(argv[i + 1]) ? DS3231_ENABLED : DS3231_DISABLED);
+        } else if (strcmp(argv[i], "--aging") == 0) {
+            int8_t aging = (int8_t) atoi(argv[i + 1]);
+            DS3231_WriteRegister(DS3231_REG_AGING, (uint8_t *) &aging);
+        } else if (strcmp(argv[i], "--regions") == 0) {
+            regions = (uint8_t) strtoul(argv[i + 1], NULL, 0);
+        } else if (strcmp(argv[i], "-o") == 0) {
+            out = argv[i + 1];
+        } else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (out == NULL || (regions & ~DS3231_IMAGE_ALL) || regions == 0) {
+        usage();
+        return 2;
+    }
+
+    DS3231_ToDateTime(&unixtime, &dt);
+    if (DS3231_SetDateTime(&dt) != HAL_OK || DS3231_ExportImage(image, regions) != HAL_OK) {
+        fprintf(stderr, "could not configure the simulator\n");
+        return 1;
+    }
+    f = fopen(out, "wb");
+    if (f == NULL || fwrite(image, 1, DS3231_IMAGE_SIZE, f) != DS3231_IMAGE_SIZE) {
+        perror(out);
+        return 1;
+    }
+    fclose(f);
+    print_image(image);
+    return 0;
+}
+
+static int cmd_check(int argc, char **argv) {
+    uint8_t image[DS3231_IMAGE_SIZE], expected[DS3231_IMAGE_REGS], regions;
+    uint32_t elapsed = 0, transactions;
+    DS3231_Sim reference;
+    int errors = 0;
+
+    if (argc < 1)
+        return usage(), 2;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--elapsed") == 0)
+            elapsed = strtoul(argv[i + 1], NULL, 0);
+    }
+    if (load(argv[0], image) != 0)
+        return 1;
+    print_image(image);
+    regions = image[3];
+
+    /* The reference imports the image as it is and then runs for the elapsed time. */
+    attach();
+    sim.Regs[DS3231_REG_STATUS] |= (1 << DS3231_A1F) | (1 << DS3231_A2F);
+    if (DS3231_ImportImage(image, 0) != HAL_OK)
+        errors++;
+    DS3231_Sim_AdvanceSeconds(&sim, elapsed);
+    reference = sim;
+
+    attach();
+    sim.Regs[DS3231_REG_STATUS] |= (1 << DS3231_A1F) | (1 << DS3231_A2F);
+    memcpy(expected, sim.Regs, sizeof(expected));
+    DS3231_BusCounter_Reset(&counter);
+    if (DS3231_ImportImage(image, elapsed) != HAL_OK) {
+        fprintf(stderr, "import failed\n");
+        return 1;
+    }
+    transactions = DS3231_BusCounter_Transactions(&counter);
+
+    for (int reg = 0; reg < DS3231_IMAGE_REGS; reg++) {
+        uint8_t carried = reg <= DS3231_REG_YEAR ? DS3231_IMAGE_TIME : reg <= DS3231_REG_A1_DATE ? DS3231_IMAGE_ALARM1
+                : reg <= DS3231_REG_A2_DATE ? DS3231_IMAGE_ALARM2 : reg == DS3231_REG_CONTROL ? DS3231_IMAGE_CONTROL
+                : reg == DS3231_REG_STATUS ? DS3231_IMAGE_STATUS : DS3231_IMAGE_AGING;
+        if (!(regions & carried))
+            continue;
+        expected[reg] = reg <= DS3231_REG_YEAR ? reference.Regs[reg] : image[DS3231_IMAGE_HEADER + reg];
+    }
+    if (regions & DS3231_IMAGE_STATUS) {
+        expected[DS3231_REG_STATUS] |= sim.Regs[DS3231_REG_STATUS] & (1 << DS3231_BSY);
+        if (!(regions & DS3231_IMAGE_TIME))
+            expected[DS3231_REG_STATUS] |= (1 << DS3231_OSF);
+    }
+    for (int reg = 0; reg < DS3231_IMAGE_REGS; reg++) {
+        if (sim.Regs[reg] != expected[reg]) {
+            fprintf(stderr, "register 0x%02X is 0x%02X, expected 0x%02X\n", reg, sim.Regs[reg], expected[reg]);
+            errors++;
+        }
+    }
+    if (transactions != DS3231_Image_Bursts(regions)) {
+        fprintf(stderr, "%u transactions for %u runs\n", (unsigned) transactions, DS3231_Image_Bursts(regions));
+        errors++;
+    }
+    printf("import after %lu s: %u transaction(s), %u bytes on the wire, %.1f us at 400 kHz, %s\n",
+           (unsigned long) elapsed, (unsigned) transactions, (unsigned) counter.WireBytes,
+           DS3231_BusCounter_WireTime_ns(&counter, 400000) / 1000.0, errors ? "MISMATCH" : "OK");
+    return errors ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    uint8_t image[DS3231_IMAGE_SIZE];
+    if (argc >= 2 && strcmp(argv[1], "make") == 0)
+        return cmd_make(argc - 2, argv + 2);
+    if (argc >= 3 && strcmp(argv[1], "check") == 0)
+        return cmd_check(argc - 2, argv + 2);
+    if (argc == 3 && strcmp(argv[1], "dump") == 0) {
+        if (load(argv[2], image) != 0)
+            return 1;
+        print_image(image);
+        return 0;
+    }
+    usage();
+    return 2;
+}
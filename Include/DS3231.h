@@ -1,4 +1,4 @@
-evic/**
+/**
  *  @brief     An STM32 HAL library written for the DS3231 real-time clock IC.
  *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
  *  @date      May 2023
@@ -12,6 +12,7 @@ extern "C" {
 #endif
 
 #include "main.h"
+#include "DS3231_config.h"
 
 #define SECONDS_FROM_1970_TO_2000 946684800
 
@@ -48,6 +49,10 @@ extern "C" {
 #define DS3231_REG_TEMP_MSB     0x11
 #define DS3231_REG_TEMP_LSB     0x12
 
+/*------------------------------------ HOUR REGISTERS BITS---------------------------------------*/
+#define DS3231_12_24            6           /* 12 hour mode when 1, in the time and both alarm hour registers */
+#define DS3231_PM               5           /* PM in 12 hour mode, 20 hour digit in 24 hour mode */
+
 /*------------------------------------ CENTURY REGISTERS BITS------------------------------------*/
 #define DS3231_CENTURY          7           /* Toggled when the years register overflows from 99 to 00 */
 
@@ -95,6 +100,10 @@ typedef enum DS3231_State {
     DS3231_DISABLED, DS3231_ENABLED
 } DS3231_State;
 
+typedef enum DS3231_HourMode {
+    DS3231_24H, DS3231_12H
+} DS3231_HourMode;
+
 typedef enum D3231_Alarm1Mode {
     DS3231_A1_EVERY_S = 0x0F,
     DS3231_A1_MATCH_S = 0x0E,
@@ -141,10 +150,65 @@ typedef struct D3231_Alarm2 {
     DS3231_State IntEn;
 } D3231_Alarm2;
 
+/* Everything the setters configure, applied at once with #DS3231_ApplyConfig. */
+typedef struct DS3231_Config {
+    DS3231_State Oscillator;            /* Keep the oscillator running on battery, EOSC inverted */
+    DS3231_State BatterySquareWave;     /* BBSQW */
+    DS3231_InterruptMode InterruptMode; /* INTCN */
+    DS3231_Rate Rate;                   /* RS2 RS1 */
+    DS3231_State Output32kHz;           /* EN32kHz */
+    int8_t AgingOffset;                 /* Aging register, 0 unless the board was trimmed */
+#if DS3231_USE_ALARMS
+    D3231_Alarm1 Alarm1;                /* IntEn is A1IE */
+    D3231_Alarm2 Alarm2;                /* IntEn is A2IE */
+#endif
+} DS3231_Config;
+
+/*------------------------------------ CONFIG CHANGE FLAGS --------------------------------------*/
+#define DS3231_CHANGED_OSCILLATOR   0x0001
+#define DS3231_CHANGED_BBSQW        0x0002
+#define DS3231_CHANGED_INTCN        0x0004
+#define DS3231_CHANGED_RATE         0x0008
+#define DS3231_CHANGED_32KHZ        0x0010
+#define DS3231_CHANGED_AGING        0x0020
+#define DS3231_CHANGED_ALARM1       0x0040      /* Alarm 1 time or mode */
+#define DS3231_CHANGED_ALARM2       0x0080      /* Alarm 2 time or mode */
+#define DS3231_CHANGED_A1IE         0x0100
+#define DS3231_CHANGED_A2IE         0x0200
+
+#include "DS3231_inline.h"
+
+#if DS3231_USE_STATS
+typedef struct DS3231_Stats {
+    uint32_t Reads;
+    uint32_t Writes;
+    uint32_t BytesRead;
+    uint32_t BytesWritten;
+    uint32_t Errors;
+} DS3231_Stats;
+#endif
+
+#if DS3231_USE_ASYNC
+/**
+ * @brief Blocking primitives of the RTOS for shared time reads, see #DS3231_SetAsyncPort.
+ * @details Lock, Wait and Broadcast have the semantics of a mutex with a condition variable, e.g.
+ * pthread_mutex_lock, pthread_cond_wait and pthread_cond_broadcast.
+ */
+typedef struct DS3231_AsyncPort {
+    void (*Lock)(void *context);
+    void (*Unlock)(void *context);
+    void (*Wait)(void *context);        /* Unlocks, blocks until the next Broadcast, locks again */
+    void (*Broadcast)(void *context);   /* Wakes every waiting task, called with the lock held */
+    void *Context;
+} DS3231_AsyncPort;
+#endif
+
 /*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
 extern I2C_HandleTypeDef *i2cHandle;
 
 HAL_StatusTypeDef DS3231_Init(I2C_HandleTypeDef *i2cHandle);
+HAL_StatusTypeDef DS3231_InitFast(I2C_HandleTypeDef *i2cHandle, const DS3231_Config *cfg, DS3231_State check_alarms,
+        uint8_t *events, uint16_t *changed);
 
 HAL_StatusTypeDef DS3231_SetBatterySquareWave(DS3231_State enable);
 HAL_StatusTypeDef DS3231_GetBatterySquareWave(DS3231_State *enable);
@@ -161,10 +225,17 @@ HAL_StatusTypeDef DS3231_GetInterruptMode(DS3231_InterruptMode *mode);
 HAL_StatusTypeDef DS3231_SetRateSelect(DS3231_Rate rate);
 HAL_StatusTypeDef DS3231_GetRateSelect(DS3231_Rate *rate);
 
+#if DS3231_USE_TEMPERATURE
+HAL_StatusTypeDef DS3231_GetTemperatureQuarters(int16_t *temp_quarters);
+#endif
+#if DS3231_USE_FLOAT_TEMPERATURE
 HAL_StatusTypeDef DS3231_GetTemperature(float *temp_real);
+#endif
 
+#if DS3231_USE_ALARMS
 HAL_StatusTypeDef DS3231_SetAlarm1(D3231_Alarm1 *A1_st);
 HAL_StatusTypeDef DS3231_GetAlarm1(D3231_Alarm1 *A1_st);
+void DS3231_DecodeAlarm1(const uint8_t data[4], D3231_Alarm1 *A1_st);
 HAL_StatusTypeDef DS3231_SetAlarm1IntEn(DS3231_State enable);
 HAL_StatusTypeDef DS3231_GetAlarm1IntEn(DS3231_State *enable);
 HAL_StatusTypeDef DS3231_GetAlarm1Flag(DS3231_State *enable);
@@ -176,20 +247,46 @@ HAL_StatusTypeDef DS3231_SetAlarm2IntEn(DS3231_State enable);
 HAL_StatusTypeDef DS3231_GetAlarm2IntEn(DS3231_State *enable);
 HAL_StatusTypeDef DS3231_GetAlarm2Flag(DS3231_State *enable);
 HAL_StatusTypeDef DS3231_ClearAlarm2Flag(void);
+#endif
+
+HAL_StatusTypeDef DS3231_GetConfig(DS3231_Config *cfg);
+HAL_StatusTypeDef DS3231_ApplyConfig(const DS3231_Config *cfg, uint16_t *changed);
 
 HAL_StatusTypeDef DS3231_SetDateTime(DS3231_DateTime *dt);
+uint8_t DS3231_EncodeDateTime(const DS3231_DateTime *dt, DS3231_HourMode mode, uint8_t *regs);
+void DS3231_DecodeDateTime(const uint8_t *regs, DS3231_DateTime *dt);
 HAL_StatusTypeDef DS3231_GetDateTime(DS3231_DateTime *dt);
+HAL_StatusTypeDef DS3231_SetHourMode(DS3231_HourMode mode);
+HAL_StatusTypeDef DS3231_GetHourMode(DS3231_HourMode *mode);
 
+#if DS3231_USE_CONVERSIONS
 void DS3231_ToUnixTime(DS3231_DateTime *dt, uint32_t *unixtime);
 void DS3231_ToDateTime(uint32_t *unixtime, DS3231_DateTime *dt);
+#endif
 
+#if !DS3231_USE_INLINE
 uint8_t DS3231_DecodeBCD(uint8_t bin);
 uint8_t DS3231_EncodeBCD(uint8_t dec);
+#endif
 
 HAL_StatusTypeDef DS3231_WriteRegister(uint8_t reg, uint8_t *data);
 HAL_StatusTypeDef DS3231_WriteRegisters(uint8_t reg, uint8_t *data, uint8_t len);
 HAL_StatusTypeDef DS3231_ReadRegister(uint8_t reg, uint8_t *data);
 HAL_StatusTypeDef DS3231_ReadRegisters(uint8_t reg, uint8_t *data, uint8_t len);
+HAL_StatusTypeDef DS3231_ReadControlStatus(uint8_t *regCONTROL, uint8_t *regSTATUS);
+
+#if DS3231_USE_STATS
+void DS3231_GetStats(DS3231_Stats *stats);
+void DS3231_ResetStats(void);
+#endif
+
+#if DS3231_USE_CACHE || DS3231_USE_ASYNC
+uint32_t DS3231_GetTimeGeneration(void);
+#endif
+
+#if DS3231_USE_ASYNC
+void DS3231_SetAsyncPort(const DS3231_AsyncPort *port, uint32_t fresh_ms);
+#endif
 
 #ifdef __cplusplus
             }
@@ -0,0 +1,465 @@
+/**
+ *  @brief     C++17 class template over the DS3231 register logic.
+ *  @details   ds3231::DS3231<Bus, CachePolicy, LockPolicy> performs the same register transactions as the C API in
+ *             DS3231.c, with the three policies resolved at compile time:\n
+ *             Bus         HalBus holds the I2C handle at run time, StaticHalBus<&hi2c1> bakes it in for a single
+ *                         device and takes no storage.\n
+ *             CachePolicy NoCache reads every register, ControlCache shadows the CONTROL register so its
+ *                         read-modify-write setters need the write only. Only use it while this object is the
+ *                         sole writer of CONTROL.\n
+ *             LockPolicy  NoLock, or any BasicLockable (std::mutex, an RTOS mutex wrapper) to make every call
+ *                         atomic on the bus.\n
+ *             DS3231<StaticHalBus<&hi2c1>> compiles to the same code as calling HAL_I2C_Mem_Read/Write by hand,
+ *             see Benchmarks/codegen_template.cpp. The object does not share state with the C API, writes made
+ *             through it do not bump #DS3231_GetTimeGeneration. Like the C API it keeps the hour mode of the
+ *             time registers, found by Init and updated by every read or write of them, and writes the time and
+ *             the alarm hours in it. SetDateTime validates and encodes with #DS3231_EncodeDateTime, so
+ *             Source/DS3231.c is linked in as well.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_HPP
+#define DS3231_HPP
+
+#include "DS3231.h"
+
+#include <cstdint>
+
+#if defined(__GNUC__)
+#define DS3231_CXX_INLINE   inline __attribute__((always_inline))  /* -Os would otherwise outline the bus calls */
+#else
+#define DS3231_CXX_INLINE   inline
+#endif
+
+namespace ds3231 {
+
+/*------------------------------------ BCD ------------------------------------------------------*/
+DS3231_CXX_INLINE constexpr std::uint8_t bcd_decode(std::uint8_t bin) noexcept {
+    return static_cast<std::uint8_t>((bin >> 4) * 10 + (bin & 0x0F));
+}
+
+DS3231_CXX_INLINE constexpr std::uint8_t bcd_encode(std::uint8_t dec) noexcept {
+    return static_cast<std::uint8_t>(dec + (dec / 10) * 6);
+}
+
+/*------------------------------------ BUS POLICIES ---------------------------------------------*/
+/* The I2C handle is chosen at run time, as with DS3231_Init. */
+class HalBus {
+public:
+    constexpr explicit HalBus(I2C_HandleTypeDef *hi2c) noexcept : hi2c_(hi2c) {}
+
+    DS3231_CXX_INLINE HAL_StatusTypeDef read(std::uint8_t reg, std::uint8_t *data, std::uint8_t len) const noexcept {
+        return HAL_I2C_Mem_Read(hi2c_, DS3231_I2C_ADDR, reg, I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+    }
+
+    DS3231_CXX_INLINE HAL_StatusTypeDef write(std::uint8_t reg, std::uint8_t *data, std::uint8_t len) const noexcept {
+        return HAL_I2C_Mem_Write(hi2c_, DS3231_I2C_ADDR, reg, I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+    }
+
+private:
+    I2C_HandleTypeDef *hi2c_;
+};
+
+/* The I2C handle is a link time constant, e.g. StaticHalBus<&hi2c1>. */
+template <I2C_HandleTypeDef *Handle>
+struct StaticHalBus {
+    DS3231_CXX_INLINE static HAL_StatusTypeDef read(std::uint8_t reg, std::uint8_t *data, std::uint8_t len) noexcept {
+        return HAL_I2C_Mem_Read(Handle, DS3231_I2C_ADDR, reg, I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+    }
+
+    DS3231_CXX_INLINE static HAL_StatusTypeDef write(std::uint8_t reg, std::uint8_t *data, std::uint8_t len) noexcept {
+        return HAL_I2C_Mem_Write(Handle, DS3231_I2C_ADDR, reg, I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+    }
+};
+
+/*------------------------------------ CACHE POLICIES -------------------------------------------*/
+struct NoCache {
+    static constexpr bool lookup_control(std::uint8_t &) noexcept { return false; }
+    static constexpr void store_control(std::uint8_t) noexcept {}
+    static constexpr void invalidate() noexcept {}
+};
+
+class ControlCache {
+public:
+    DS3231_CXX_INLINE bool lookup_control(std::uint8_t &control) const noexcept {
+        control = control_;
+        return valid_;
+    }
+
+    /* CONV clears itself once the conversion is done, never replay it. */
+    DS3231_CXX_INLINE void store_control(std::uint8_t control) noexcept {
+        control_ = static_cast<std::uint8_t>(control & ~(1U << DS3231_CONV));
+        valid_ = true;
+    }
+
+    DS3231_CXX_INLINE void invalidate() noexcept { valid_ = false; }
+
+private:
+    std::uint8_t control_ = 0;
+    bool valid_ = false;
+};
+
+/*------------------------------------ LOCK POLICIES --------------------------------------------*/
+struct NoLock {
+    static constexpr void lock() noexcept {}
+    static constexpr void unlock() noexcept {}
+};
+
+/*------------------------------------ DRIVER ---------------------------------------------------*/
+template <typename Bus, typename CachePolicy = NoCache, typename LockPolicy = NoLock>
+class DS3231 : private Bus, private CachePolicy, private LockPolicy {
+public:
+    template <typename B = Bus, typename = decltype(B())>
+    constexpr DS3231() noexcept {}
+
+    constexpr explicit DS3231(const Bus &bus) noexcept : Bus(bus) {}
+
+    DS3231(const DS3231 &) = delete;
+    DS3231 &operator=(const DS3231 &) = delete;
+
+    /* Leaves the chip as #DS3231_Init does, in five transactions, the first reads the hour mode. */
+    HAL_StatusTypeDef Init() noexcept {
+        guard g(*this);
+        HAL_StatusTypeDef status;
+        std::uint8_t reg;
+        CachePolicy::invalidate();
+        status = Bus::read(DS3231_REG_HOUR, &reg, 1);
+        if (status != HAL_OK)
+            return status;
+        hour_mode_ = DS3231_Hour_Mode(reg);
+        status = update_control((1U << DS3231_A1IE) | (1U << DS3231_A2IE) | (1U << DS3231_INTCN),
+                                1U << DS3231_INTCN);
+        if (status != HAL_OK)
+            return status;
+        status = Bus::read(DS3231_REG_STATUS, &reg, 1);
+        if (status != HAL_OK)
+            return status;
+        reg &= static_cast<std::uint8_t>(~((1U << DS3231_A1F) | (1U << DS3231_A2F) | (1U << DS3231_EN32KHZ)));
+        return Bus::write(DS3231_REG_STATUS, &reg, 1);
+    }
+
+    HAL_StatusTypeDef SetBatterySquareWave(DS3231_State enable) noexcept {
+        guard g(*this);
+        return update_control(1U << DS3231_BBSQW, (enable & 0x01U) << DS3231_BBSQW);
+    }
+
+    HAL_StatusTypeDef GetBatterySquareWave(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t control;
+        HAL_StatusTypeDef status = read_control(control);
+        if (status == HAL_OK)
+            *enable = DS3231_Control_BatterySquareWave(control);
+        return status;
+    }
+
+    HAL_StatusTypeDef SetOscillator(DS3231_State enable) noexcept {
+        guard g(*this);
+        return update_control(1U << DS3231_EOSC, (!enable & 0x01U) << DS3231_EOSC);
+    }
+
+    HAL_StatusTypeDef GetOscillatorStoppedFlag(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t data = 0;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_STATUS, &data, 1);
+        *enable = static_cast<DS3231_State>(!DS3231_Status_OscillatorStopped(data));
+        return status;
+    }
+
+    HAL_StatusTypeDef Set32kHzOutput(DS3231_State enable) noexcept {
+        guard g(*this);
+        return update_status(1U << DS3231_EN32KHZ, (enable & 0x01U) << DS3231_EN32KHZ);
+    }
+
+    HAL_StatusTypeDef Get32kHzEnabled(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t data = 0;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_STATUS, &data, 1);
+        *enable = DS3231_Status_32kHzEnabled(data);
+        return status;
+    }
+
+    HAL_StatusTypeDef SetInterruptMode(DS3231_InterruptMode mode) noexcept {
+        guard g(*this);
+        return update_control(1U << DS3231_INTCN, (mode & 0x01U) << DS3231_INTCN);
+    }
+
+    HAL_StatusTypeDef GetInterruptMode(DS3231_InterruptMode *mode) noexcept {
+        guard g(*this);
+        std::uint8_t control;
+        HAL_StatusTypeDef status = read_control(control);
+        if (status == HAL_OK)
+            *mode = DS3231_Control_InterruptMode(control);
+        return status;
+    }
+
+    /* Like #DS3231_SetRateSelect this also sets INTCN. */
+    HAL_StatusTypeDef SetRateSelect(DS3231_Rate rate) noexcept {
+        guard g(*this);
+        HAL_StatusTypeDef status = update_control(0x03U << DS3231_RS1, (rate & 0x03U) << DS3231_RS1);
+        if (status != HAL_OK)
+            return status;
+        return update_control(1U << DS3231_INTCN, 1U << DS3231_INTCN);
+    }
+
+    HAL_StatusTypeDef GetRateSelect(DS3231_Rate *rate) noexcept {
+        guard g(*this);
+        std::uint8_t control;
+        HAL_StatusTypeDef status = read_control(control);
+        if (status == HAL_OK)
+            *rate = DS3231_Control_Rate(control);
+        return status;
+    }
+
+#if DS3231_USE_TEMPERATURE
+    HAL_StatusTypeDef GetTemperatureQuarters(std::int16_t *temp_quarters) noexcept {
+        guard g(*this);
+        std::uint8_t buffer[2];
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_TEMP_MSB, buffer, 2);
+        if (status == HAL_OK)
+            *temp_quarters = static_cast<std::int16_t>(static_cast<std::int8_t>(buffer[0]) * 4 + (buffer[1] >> 6));
+        return status;
+    }
+#endif
+
+#if DS3231_USE_ALARMS
+    HAL_StatusTypeDef SetAlarm1(const D3231_Alarm1 *A1_st) noexcept {
+        guard g(*this);
+        std::uint8_t data[4] = {
+            static_cast<std::uint8_t>(bcd_encode(A1_st->Seconds) | (A1_st->Mode & 0x01) << 7),
+            static_cast<std::uint8_t>(bcd_encode(A1_st->Minutes) | (A1_st->Mode & 0x02) << 6),
+            static_cast<std::uint8_t>(DS3231_Hour_Encode(A1_st->Hours, hour_mode_) | (A1_st->Mode & 0x04) << 5),
+            static_cast<std::uint8_t>(bcd_encode(A1_st->DayDate) | (A1_st->Mode & 0x10) << 2
+                                      | (A1_st->Mode & 0x08) << 4) };
+        HAL_StatusTypeDef status = Bus::write(DS3231_REG_A1_SECOND, data, 4);
+        if (status != HAL_OK)
+            return status;
+        return set_alarm_int_en(DS3231_A1IE, A1_st->IntEn);
+    }
+
+    HAL_StatusTypeDef GetAlarm1(D3231_Alarm1 *A1_st) noexcept {
+        guard g(*this);
+        std::uint8_t data[4], control;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_A1_SECOND, data, 4);
+        if (status != HAL_OK)
+            return status;
+        A1_st->Mode = static_cast<DS3231_Alarm1Mode>((data[0] & 0x80) >> 7 | (data[1] & 0x80) >> 6
+                | (data[2] & 0x80) >> 5 | (data[3] & 0x80) >> 4 | (data[3] & 0x40) >> 2);
+        A1_st->Seconds = bcd_decode(data[0] & 0x7F);
+        A1_st->Minutes = bcd_decode(data[1] & 0x7F);
+        A1_st->Hours = DS3231_Hour_Decode(data[2]);
+        A1_st->DayDate = bcd_decode(data[3] & ((data[3] & 0x40) ? 0x0F : 0x3F));
+        status = read_control(control);
+        if (status == HAL_OK)
+            A1_st->IntEn = DS3231_Control_Alarm1IntEn(control);
+        return status;
+    }
+
+    HAL_StatusTypeDef SetAlarm1IntEn(DS3231_State enable) noexcept {
+        guard g(*this);
+        return set_alarm_int_en(DS3231_A1IE, enable);
+    }
+
+    HAL_StatusTypeDef GetAlarm1IntEn(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t control;
+        HAL_StatusTypeDef status = read_control(control);
+        if (status == HAL_OK)
+            *enable = DS3231_Control_Alarm1IntEn(control);
+        return status;
+    }
+
+    HAL_StatusTypeDef GetAlarm1Flag(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t data = 0;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_STATUS, &data, 1);
+        *enable = DS3231_Status_Alarm1Flag(data);
+        return status;
+    }
+
+    HAL_StatusTypeDef ClearAlarm1Flag() noexcept {
+        guard g(*this);
+        return update_status(1U << DS3231_A1F, 0);
+    }
+
+    HAL_StatusTypeDef SetAlarm2(const D3231_Alarm2 *A2_st) noexcept {
+        guard g(*this);
+        std::uint8_t data[3] = {
+            static_cast<std::uint8_t>(bcd_encode(A2_st->Minutes) | (A2_st->Mode & 0x01) << 7),
+            static_cast<std::uint8_t>(DS3231_Hour_Encode(A2_st->Hours, hour_mode_) | (A2_st->Mode & 0x02) << 6),
+            static_cast<std::uint8_t>(bcd_encode(A2_st->DayDate) | (A2_st->Mode & 0x08) << 3
+                                      | (A2_st->Mode & 0x04) << 5) };
+        HAL_StatusTypeDef status = Bus::write(DS3231_REG_A2_MINUTE, data, 3);
+        if (status != HAL_OK)
+            return status;
+        return set_alarm_int_en(DS3231_A2IE, A2_st->IntEn);
+    }
+
+    HAL_StatusTypeDef GetAlarm2(D3231_Alarm2 *A2_st) noexcept {
+        guard g(*this);
+        std::uint8_t data[3], control;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_A2_MINUTE, data, 3);
+        if (status != HAL_OK)
+            return status;
+        A2_st->Mode = static_cast<DS3231_Alarm2Mode>((data[0] & 0x80) >> 7 | (data[1] & 0x80) >> 6
+                | (data[2] & 0x80) >> 5 | (data[2] & 0x40) >> 3);
+        A2_st->Minutes = bcd_decode(data[0] & 0x7F);
+        A2_st->Hours = DS3231_Hour_Decode(data[1]);
+        A2_st->DayDate = bcd_decode(data[2] & ((data[2] & 0x40) ? 0x0F : 0x3F));
+        status = read_control(control);
+        if (status == HAL_OK)
+            A2_st->IntEn = DS3231_Control_Alarm2IntEn(control);
+        return status;
+    }
+
+    HAL_StatusTypeDef SetAlarm2IntEn(DS3231_State enable) noexcept {
+        guard g(*this);
+        return set_alarm_int_en(DS3231_A2IE, enable);
+    }
+
+    HAL_StatusTypeDef GetAlarm2IntEn(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t control;
+        HAL_StatusTypeDef status = read_control(control);
+        if (status == HAL_OK)
+            *enable = DS3231_Control_Alarm2IntEn(control);
+        return status;
+    }
+
+    HAL_StatusTypeDef GetAlarm2Flag(DS3231_State *enable) noexcept {
+        guard g(*this);
+        std::uint8_t data = 0;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_STATUS, &data, 1);
+        *enable = DS3231_Status_Alarm2Flag(data);
+        return status;
+    }
+
+    HAL_StatusTypeDef ClearAlarm2Flag() noexcept {
+        guard g(*this);
+        return update_status(1U << DS3231_A2F, 0);
+    }
+#endif
+
+    /* Years 2000 to 2199, written in the hour mode kept by the object, GetDateTime decodes either mode. Fields are
+       checked as by DS3231_EncodeDateTime, dates against their month, and refused before anything is written. */
+    HAL_StatusTypeDef SetDateTime(const DS3231_DateTime *dt) noexcept {
+        std::uint8_t buffer[7];
+        guard g(*this);
+        if (DS3231_EncodeDateTime(dt, hour_mode_, buffer) != 0)
+            return HAL_ERROR;
+        HAL_StatusTypeDef status = Bus::write(DS3231_REG_SECOND, buffer, 7);
+        if (status != HAL_OK)
+            return status;
+        return update_control(1U << DS3231_EOSC, dt->Enable == DS3231_ENABLED ? 0 : 1U << DS3231_EOSC);
+    }
+
+    /* Inlined so that keeping the hour mode costs nothing on a temporary or an unused object. */
+    DS3231_CXX_INLINE HAL_StatusTypeDef GetDateTime(DS3231_DateTime *dt) noexcept {
+        guard g(*this);
+        std::uint8_t buffer[7], regSTATUS;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_SECOND, buffer, 7);
+        if (status != HAL_OK)
+            return status;
+        dt->Second = bcd_decode(buffer[0] & 0x7F);
+        dt->Minute = bcd_decode(buffer[1] & 0x7F);
+        dt->Hour_24mode = DS3231_Hour_Decode(buffer[2]);
+        hour_mode_ = DS3231_Hour_Mode(buffer[2]);
+        dt->Day = bcd_decode(buffer[3] & 0x07);
+        dt->Date = bcd_decode(buffer[4] & 0x3F);
+        dt->Month = bcd_decode(buffer[5] & 0x1F);
+        dt->Year = static_cast<std::uint16_t>(bcd_decode(buffer[6]) + 2000U + (buffer[5] >> DS3231_CENTURY) * 100U);
+        status = Bus::read(DS3231_REG_STATUS, &regSTATUS, 1);
+        if (status != HAL_OK)
+            return status;
+        dt->Enable = (regSTATUS & 0x80) ? DS3231_DISABLED : DS3231_ENABLED;
+        return status;
+    }
+
+    /* Raw access, a write covering CONTROL drops the cached copy, one covering HOUR sets the hour mode. */
+    HAL_StatusTypeDef ReadRegisters(std::uint8_t reg, std::uint8_t *data, std::uint8_t len) noexcept {
+        guard g(*this);
+        return Bus::read(reg, data, len);
+    }
+
+    HAL_StatusTypeDef WriteRegisters(std::uint8_t reg, std::uint8_t *data, std::uint8_t len) noexcept {
+        guard g(*this);
+        if (reg <= DS3231_REG_CONTROL && reg + len > DS3231_REG_CONTROL)
+            CachePolicy::invalidate();
+        HAL_StatusTypeDef status = Bus::write(reg, data, len);
+        if (status == HAL_OK && reg <= DS3231_REG_HOUR && reg + len > DS3231_REG_HOUR)
+            hour_mode_ = DS3231_Hour_Mode(data[DS3231_REG_HOUR - reg]);
+        return status;
+    }
+
+    HAL_StatusTypeDef ReadControlStatus(std::uint8_t *regCONTROL, std::uint8_t *regSTATUS) noexcept {
+        guard g(*this);
+        std::uint8_t buffer[2];
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_CONTROL, buffer, 2);
+        if (status != HAL_OK)
+            return status;
+        CachePolicy::store_control(buffer[0]);
+        *regCONTROL = buffer[0];
+        *regSTATUS = buffer[1];
+        return status;
+    }
+
+    void InvalidateCache() noexcept {
+        guard g(*this);
+        CachePolicy::invalidate();
+    }
+
+private:
+    DS3231_HourMode hour_mode_ = DS3231_24H;   /* Mode of the time registers as last read or written */
+
+    struct guard {
+        DS3231_CXX_INLINE explicit guard(DS3231 &dev) noexcept : lock(dev) { lock.lock(); }
+        DS3231_CXX_INLINE ~guard() { lock.unlock(); }
+        LockPolicy &lock;
+    };
+
+    DS3231_CXX_INLINE HAL_StatusTypeDef read_control(std::uint8_t &control) noexcept {
+        if (CachePolicy::lookup_control(control))
+            return HAL_OK;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_CONTROL, &control, 1);
+        if (status == HAL_OK)
+            CachePolicy::store_control(control);
+        return status;
+    }
+
+    /* Read-modify-write of CONTROL, the read is skipped while the cache holds the register. */
+    DS3231_CXX_INLINE HAL_StatusTypeDef update_control(unsigned mask, unsigned bits) noexcept {
+        std::uint8_t control;
+        HAL_StatusTypeDef status = read_control(control);
+        if (status != HAL_OK)
+            return status;
+        control = static_cast<std::uint8_t>((control & ~mask) | bits);
+        status = Bus::write(DS3231_REG_CONTROL, &control, 1);
+        if (status == HAL_OK)
+            CachePolicy::store_control(control);
+        else
+            CachePolicy::invalidate();
+        return status;
+    }
+
+    /* STATUS holds flags set by the chip, it is always read. */
+    DS3231_CXX_INLINE HAL_StatusTypeDef update_status(unsigned mask, unsigned bits) noexcept {
+        std::uint8_t reg;
+        HAL_StatusTypeDef status = Bus::read(DS3231_REG_STATUS, &reg, 1);
+        if (status != HAL_OK)
+            return status;
+        reg = static_cast<std::uint8_t>((reg & ~mask) | bits);
+        return Bus::write(DS3231_REG_STATUS, &reg, 1);
+    }
+
+    /* Like the C API, enabling or disabling an alarm interrupt also selects the alarm function of INT#/SQW. */
+    DS3231_CXX_INLINE HAL_StatusTypeDef set_alarm_int_en(unsigned bit, DS3231_State enable) noexcept {
+        HAL_StatusTypeDef status = update_control(1U << bit, (enable & 0x01U) << bit);
+        if (status != HAL_OK)
+            return status;
+        return update_control(1U << DS3231_INTCN, 1U << DS3231_INTCN);
+    }
+};
+
+} // namespace ds3231
+
+#endif /* DS3231_HPP */
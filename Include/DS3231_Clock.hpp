@@ -0,0 +1,215 @@
+/**
+ *  @brief     std::chrono clock backed by the DS3231.
+ *  @details   ds3231::clock meets the TrivialClock requirements. Its epoch is 1970-01-01 00:00:00 UTC and its
+ *             resolution is the HAL tick (1 ms).\n
+ *             now() reads the device through #DS3231_GetDateTime and #DS3231_ToUnixTime only to (re)synchronise.
+ *             It locates the RTC second boundary by polling every #DS3231_CLOCK_POLL_MS until the seconds
+ *             change, then extrapolates with HAL_GetTick(). After #DS3231_CLOCK_RESYNC_MS it polls again around
+ *             the predicted boundary to correct tick drift. Calling now() in a tight loop therefore costs no bus
+ *             traffic between resyncs. Until the first boundary is found the clock has whole second resolution.
+ *             With #DS3231_USE_CACHE any write to the time registers restarts synchronisation, otherwise call
+ *             ds3231::clock::invalidate() after setting the time.\n
+ *             The calendar conversions are constexpr. Requires C++17 and #DS3231_USE_CONVERSIONS.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_CLOCK_HPP
+#define DS3231_CLOCK_HPP
+
+#include "DS3231.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#if !DS3231_USE_CONVERSIONS
+#error "ds3231::clock needs DS3231_USE_CONVERSIONS"
+#endif
+
+#ifndef DS3231_CLOCK_POLL_MS
+#define DS3231_CLOCK_POLL_MS        10      /* Poll period while looking for a second boundary */
+#endif
+
+#ifndef DS3231_CLOCK_RESYNC_MS
+#define DS3231_CLOCK_RESYNC_MS      10000   /* Extrapolate this long before checking the boundary again */
+#endif
+
+namespace ds3231 {
+
+/*------------------------------------ CALENDAR -------------------------------------------------*/
+/* Days since 1970-01-01 of a proleptic Gregorian date, after H. Hinnant's days_from_civil. */
+constexpr std::int64_t days_from_civil(std::int64_t y, unsigned m, unsigned d) noexcept {
+    y -= m <= 2;
+    const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+constexpr std::int64_t to_unix_seconds(const DS3231_DateTime &dt) noexcept {
+    return days_from_civil(dt.Year, dt.Month, dt.Date) * 86400 + dt.Hour_24mode * 3600 + dt.Minute * 60
+            + dt.Second;
+}
+
+constexpr DS3231_DateTime to_datetime(std::int64_t unix_seconds) noexcept {
+    const std::int64_t days = (unix_seconds >= 0 ? unix_seconds : unix_seconds - 86399) / 86400;
+    const std::int64_t sod = unix_seconds - days * 86400;
+    const std::int64_t z = days + 719468;
+    const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned month = mp < 10 ? mp + 3 : mp - 9;
+    DS3231_DateTime dt {};
+    dt.Year = static_cast<std::uint16_t>(yoe + era * 400 + (month <= 2));
+    dt.Month = static_cast<std::uint8_t>(month);
+    dt.Date = static_cast<std::uint8_t>(doy - (153 * mp + 2) / 5 + 1);
+    dt.Day = static_cast<std::uint8_t>(((days % 7 + 7 + 3) % 7) + DS3231_MON);     /* 1970-01-01 was a Thursday */
+    dt.Hour_24mode = static_cast<std::uint8_t>(sod / 3600);
+    dt.Minute = static_cast<std::uint8_t>(sod / 60 % 60);
+    dt.Second = static_cast<std::uint8_t>(sod % 60);
+    dt.Enable = DS3231_ENABLED;
+    return dt;
+}
+
+/*------------------------------------ CLOCK ----------------------------------------------------*/
+class clock {
+public:
+    using rep = std::int64_t;
+    using period = std::milli;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<clock>;
+    static constexpr bool is_steady = false;      /* The RTC can be set */
+
+    static time_point now() noexcept;
+    static void invalidate() noexcept { state_.valid = false; }
+
+    static constexpr std::time_t to_time_t(const time_point &t) noexcept {
+        return static_cast<std::time_t>(std::chrono::floor<std::chrono::seconds>(t.time_since_epoch()).count());
+    }
+
+    static constexpr time_point from_time_t(std::time_t t) noexcept {
+        return time_point(std::chrono::seconds(t));
+    }
+
+    static constexpr time_point from_datetime(const DS3231_DateTime &dt) noexcept {
+        return time_point(std::chrono::seconds(to_unix_seconds(dt)));
+    }
+
+    static constexpr DS3231_DateTime to_datetime(const time_point &t) noexcept {
+        return ds3231::to_datetime(to_time_t(t));
+    }
+
+    /* system_clock counts from the unix epoch on every supported platform, guaranteed since C++20. */
+    static std::chrono::system_clock::time_point to_sys(const time_point &t) noexcept {
+        return std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(t.time_since_epoch()));
+    }
+
+private:
+    struct state {
+        bool valid;
+        bool locked;                /* anchor_* mark a located second boundary */
+        std::uint32_t poll_unix;    /* Unix seconds and tick of the last read */
+        std::uint32_t poll_tick;
+        std::uint32_t anchor_unix;
+        std::uint32_t anchor_tick;
+        std::uint32_t generation;
+        rep last;                   /* Last value returned, keeps re-anchoring from stepping back */
+    };
+
+    static inline state state_ {};
+
+    static bool due(std::uint32_t tick) noexcept;
+    static void poll(std::uint32_t tick) noexcept;
+};
+
+/* Whether now() has to read the device at this tick. */
+inline bool clock::due(std::uint32_t tick) noexcept {
+    if (!state_.valid)
+        return true;
+    if (tick - state_.poll_tick < DS3231_CLOCK_POLL_MS)
+        return false;
+    if (!state_.locked)
+        return true;
+    const std::uint32_t elapsed = tick - state_.anchor_tick;
+    if (elapsed < DS3231_CLOCK_RESYNC_MS)
+        return false;
+    /* Poll around the predicted boundary only, and everywhere once two predicted boundaries were missed. */
+    const std::uint32_t phase = elapsed % 1000U;
+    return phase < 2 * DS3231_CLOCK_POLL_MS || phase >= 1000U - 2 * DS3231_CLOCK_POLL_MS
+            || elapsed >= DS3231_CLOCK_RESYNC_MS + 2000U;
+}
+
+inline void clock::poll(std::uint32_t tick) noexcept {
+    DS3231_DateTime dt;
+    std::uint32_t unixtime;
+    if (DS3231_GetDateTime(&dt) != HAL_OK) {
+        state_.poll_tick = tick;    /* Keep extrapolating, retry after the poll period */
+        return;
+    }
+    DS3231_ToUnixTime(&dt, &unixtime);
+    if (state_.valid && unixtime == state_.poll_unix + 1 && tick - state_.poll_tick <= 2 * DS3231_CLOCK_POLL_MS) {
+        /* The boundary lies between the two reads, take the middle. */
+        state_.anchor_unix = unixtime;
+        state_.anchor_tick = tick - (tick - state_.poll_tick) / 2;
+        state_.locked = true;
+    } else if (state_.locked) {
+        /* Drop the anchor when the device disagrees with the extrapolation by more than the rounding. */
+        const std::uint32_t expected = state_.anchor_unix + (tick - state_.anchor_tick) / 1000U;
+        if (unixtime + 1 < expected || unixtime > expected + 1)
+            state_.locked = false;
+    }
+    state_.poll_unix = unixtime;
+    state_.poll_tick = tick;
+    state_.valid = true;
+}
+
+/**
+ * @brief Current time.
+ * @return Milliseconds since the unix epoch, never less than the previous call unless the time was set.
+ * @note Bus errors are not reported, the clock keeps extrapolating from the last good read.
+ */
+inline clock::time_point clock::now() noexcept {
+    const std::uint32_t tick = HAL_GetTick();
+    rep ms;
+#if DS3231_USE_CACHE
+    const std::uint32_t generation = DS3231_GetTimeGeneration();
+    if (state_.generation != generation) {
+        state_.generation = generation;
+        state_.valid = false;
+    }
+#endif
+    if (!state_.valid) {
+        state_.locked = false;
+        state_.last = 0;
+    }
+    if (due(tick))
+        poll(tick);
+    if (!state_.valid)
+        return time_point(duration(state_.last));
+    if (state_.locked)
+        ms = static_cast<rep>(state_.anchor_unix) * 1000 + static_cast<std::uint32_t>(tick - state_.anchor_tick);
+    else
+        ms = static_cast<rep>(state_.poll_unix) * 1000;
+    if (ms < state_.last)
+        ms = state_.last;
+    state_.last = ms;
+    return time_point(duration(ms));
+}
+
+/*------------------------------------ COMPILE TIME CHECKS --------------------------------------*/
+static_assert(days_from_civil(1970, 1, 1) == 0, "unix epoch");
+static_assert(days_from_civil(2000, 3, 1) == 11017, "leap day of a 400 year century");
+static_assert(clock::from_datetime(DS3231_DateTime { DS3231_SAT, 1, 1, 2000, 0, 0, 0, DS3231_ENABLED })
+        .time_since_epoch().count() == 946684800000LL, "2000-01-01");
+static_assert(to_datetime(4107542399LL).Year == 2100 && to_datetime(4107542399LL).Month == 2
+        && to_datetime(4107542399LL).Date == 28, "2100 is not a leap year");
+static_assert(to_datetime(0).Day == DS3231_THU, "1970-01-01 was a Thursday");
+
+} // namespace ds3231
+
+#endif /* DS3231_CLOCK_HPP */
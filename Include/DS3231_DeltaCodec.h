@@ -0,0 +1,73 @@
+/**
+ *  @brief     Delta-of-delta timestamp compression for RTC stamped logs.
+ *  @details   Timestamps are stored in fixed size blocks. Each block starts with an absolute anchor and is then
+ *             followed by variable length delta-of-delta codes, as in Facebook's Gorilla:\n
+ *             | '0' same interval | '10' + 7 bits | '110' + 9 bits | '1110' + 12 bits | '11110' + 32 bits | '11111' + 64 bits |\n
+ *             A log written at a steady cadence costs one bit per timestamp. Sub-second fractions are kept to
+ *             the number of bits chosen per block.\n
+ *             Block layout, multi-byte fields little endian:\n
+ *             | 0 version | 1 fraction bits | 2..3 count | 4..7 anchor seconds | 8..9 anchor fraction | 10.. codes |\n
+ *             Every block decodes on its own, #DS3231_DeltaFindBlock binary searches the anchors for random access.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_DELTACODEC_H
+#define DS3231_DELTACODEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+#include <stddef.h>
+
+/*------------------------------------ BLOCK LAYOUT ---------------------------------------------*/
+#define DS3231_DELTA_VERSION        1
+#define DS3231_DELTA_HEADER_SIZE    10
+#define DS3231_DELTA_MAX_FRACTION   16      /* Fractions are given in 1/65536 s */
+
+typedef struct DS3231_DeltaTime {
+    uint32_t Seconds;           /* Unix time, e.g. from #DS3231_ToUnixTime */
+    uint16_t Fraction;          /* Sub-second part in 1/65536 s, 0 when not available */
+} DS3231_DeltaTime;
+
+typedef struct DS3231_DeltaEncoder {
+    uint8_t *Block;
+    uint16_t Size;              /* Block size in bytes */
+    uint16_t Count;             /* Timestamps in the block */
+    uint32_t BitPos;            /* Next free bit, MSB first */
+    uint8_t FractionBits;
+    uint64_t Prev;              /* Previous timestamp in 1/2^FractionBits s */
+    int64_t PrevDelta;
+} DS3231_DeltaEncoder;
+
+typedef struct DS3231_DeltaDecoder {
+    const uint8_t *Block;
+    uint16_t Size;
+    uint16_t Count;
+    uint16_t Index;             /* Timestamps returned so far */
+    uint32_t BitPos;
+    uint8_t FractionBits;
+    uint64_t Prev;
+    int64_t PrevDelta;
+} DS3231_DeltaDecoder;
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+HAL_StatusTypeDef DS3231_DeltaEncoder_Begin(DS3231_DeltaEncoder *enc, uint8_t *block, uint16_t size,
+        uint8_t fraction_bits);
+uint8_t DS3231_DeltaEncoder_Append(DS3231_DeltaEncoder *enc, DS3231_DeltaTime *time);
+uint16_t DS3231_DeltaEncoder_Used(DS3231_DeltaEncoder *enc);
+
+HAL_StatusTypeDef DS3231_DeltaDecoder_Begin(DS3231_DeltaDecoder *dec, const uint8_t *block, uint16_t size);
+uint8_t DS3231_DeltaDecoder_Next(DS3231_DeltaDecoder *dec, DS3231_DeltaTime *time);
+
+void DS3231_DeltaBlockAnchor(const uint8_t *block, DS3231_DeltaTime *time);
+size_t DS3231_DeltaFindBlock(const uint8_t *blocks, size_t count, uint16_t size, DS3231_DeltaTime *time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_DELTACODEC_H */
@@ -0,0 +1,117 @@
+/**
+ *  @brief     Conversions between unix time and the NTP, GPS, TAI and Julian day time scales.
+ *  @details   Every conversion is a fixed sequence of additions, multiplications and shifts: no branches and no
+ *             division, so it takes the same time for every input, also on cores without a divide instruction
+ *             where the C library division loops (Cortex-M0). Divisions by 86400 and 604800 are done with
+ *             reciprocal multiplications that are exact for every uint32_t.\n
+ *             Sub-second times are 32.32 fixed point as in DS3231_TickMap.h: seconds in the upper and the fraction
+ *             of the second in the lower 32 bits. Unix time counts UTC seconds without leap seconds, GPS and TAI
+ *             take the current TAI - UTC offset, #DS3231_EPOCH_TAI_UTC.\n
+ *             The scalar converters are inline, the batch variants in DS3231_Epoch.c run them over arrays.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_EPOCH_H
+#define DS3231_EPOCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ EPOCH OFFSETS --------------------------------------------*/
+#define DS3231_EPOCH_NTP_UNIX       2208988800UL    /* Seconds from 1900-01-01 to 1970-01-01 */
+#define DS3231_EPOCH_UNIX_GPS       315964800UL     /* Seconds from 1970-01-01 to 1980-01-06 */
+#define DS3231_EPOCH_TAI_GPS        19              /* TAI - GPS, fixed */
+#ifndef DS3231_EPOCH_TAI_UTC
+#define DS3231_EPOCH_TAI_UTC        37              /* TAI - UTC since 2017-01-01 */
+#endif
+#define DS3231_EPOCH_MJD_UNIX       40587UL         /* Modified Julian Date of 1970-01-01 */
+#define DS3231_EPOCH_JD_MJD         2400000UL       /* JD = MJD + 2400000.5 */
+#define DS3231_EPOCH_DAY_S          86400UL
+#define DS3231_EPOCH_WEEK_S         604800UL
+
+/* x / 86400 and x / 604800 for every uint32_t x: 86400 = 2^7 * 675, 604800 = 2^7 * 4725. */
+#define DS3231_EPOCH_DIV_DAY(x)     ((uint32_t) (((uint64_t) ((uint32_t) (x) >> 7) * 50903317ULL) >> 35))
+#define DS3231_EPOCH_DIV_WEEK(x)    ((uint32_t) (((uint64_t) ((uint32_t) (x) >> 7) * 58175219ULL) >> 38))
+/* ceil(2^48 / 86400), seconds of the day to 2^-32 day */
+#define DS3231_EPOCH_DAY_FRACTION   3257812231ULL
+
+typedef struct DS3231_GpsTime {
+    uint16_t Week;              /* Full week number since 1980-01-06, not modulo 1024 */
+    uint32_t Tow;               /* Seconds of the week, 0..604799 */
+} DS3231_GpsTime;
+
+/*------------------------------------ SCALAR CONVERTERS ----------------------------------------*/
+/* NTP timestamp from 32.32 unix time. The seconds wrap in 2036 into NTP era 1, as on the wire. */
+DS3231_INLINE uint64_t DS3231_Epoch_UnixToNTP(uint64_t unixtime) {
+    return unixtime + ((uint64_t) DS3231_EPOCH_NTP_UNIX << 32);
+}
+
+/* 32.32 unix time from an NTP timestamp of era 0 or 1, for times from 1970 to 2106. */
+DS3231_INLINE uint64_t DS3231_Epoch_NTPToUnix(uint64_t ntp) {
+    return ntp - ((uint64_t) DS3231_EPOCH_NTP_UNIX << 32);
+}
+
+/* 32.32 TAI seconds since 1970-01-01 TAI, the PTP time scale. */
+DS3231_INLINE uint64_t DS3231_Epoch_UnixToTAI(uint64_t unixtime, uint8_t tai_utc) {
+    return unixtime + ((uint64_t) tai_utc << 32);
+}
+
+DS3231_INLINE uint64_t DS3231_Epoch_TAIToUnix(uint64_t tai, uint8_t tai_utc) {
+    return tai - ((uint64_t) tai_utc << 32);
+}
+
+/* GPS week and time of week, for times from 1980-01-06 on. */
+DS3231_INLINE DS3231_GpsTime DS3231_Epoch_UnixToGPS(uint32_t unixtime, uint8_t tai_utc) {
+    const uint32_t seconds = unixtime - DS3231_EPOCH_UNIX_GPS + tai_utc - DS3231_EPOCH_TAI_GPS;
+    const uint32_t week = DS3231_EPOCH_DIV_WEEK(seconds);
+    DS3231_GpsTime gps = { (uint16_t) week, seconds - week * DS3231_EPOCH_WEEK_S };
+    return gps;
+}
+
+DS3231_INLINE uint32_t DS3231_Epoch_GPSToUnix(DS3231_GpsTime gps, uint8_t tai_utc) {
+    return gps.Week * DS3231_EPOCH_WEEK_S + gps.Tow + DS3231_EPOCH_UNIX_GPS - tai_utc + DS3231_EPOCH_TAI_GPS;
+}
+
+/* Modified Julian Date, the seconds of the day go to *sod. */
+DS3231_INLINE uint32_t DS3231_Epoch_UnixToMJD(uint32_t unixtime, uint32_t *sod) {
+    const uint32_t days = DS3231_EPOCH_DIV_DAY(unixtime);
+    *sod = unixtime - days * DS3231_EPOCH_DAY_S;
+    return days + DS3231_EPOCH_MJD_UNIX;
+}
+
+DS3231_INLINE uint32_t DS3231_Epoch_MJDToUnix(uint32_t mjd, uint32_t sod) {
+    return (mjd - DS3231_EPOCH_MJD_UNIX) * DS3231_EPOCH_DAY_S + sod;
+}
+
+/* Julian Day as 32.32 fixed point days, the day starts at noon. Converting back gives the same second. */
+DS3231_INLINE uint64_t DS3231_Epoch_UnixToJD(uint32_t unixtime) {
+    const uint32_t days = DS3231_EPOCH_DIV_DAY(unixtime);
+    const uint32_t sod = unixtime - days * DS3231_EPOCH_DAY_S;
+    const uint64_t fraction = ((sod * DS3231_EPOCH_DAY_FRACTION) >> 16) + 1;
+    return ((uint64_t) (days + DS3231_EPOCH_MJD_UNIX + DS3231_EPOCH_JD_MJD) << 32) + fraction + 0x80000000ULL;
+}
+
+DS3231_INLINE uint32_t DS3231_Epoch_JDToUnix(uint64_t jd) {
+    const uint64_t since = jd - ((uint64_t) (DS3231_EPOCH_MJD_UNIX + DS3231_EPOCH_JD_MJD) << 32) - 0x80000000ULL;
+    return (uint32_t) (since >> 32) * DS3231_EPOCH_DAY_S
+            + (uint32_t) (((uint64_t) (uint32_t) since * DS3231_EPOCH_DAY_S) >> 32);
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+void DS3231_Epoch_ToNTPBatch(const uint32_t *unixtime, uint64_t *ntp, uint32_t count);
+void DS3231_Epoch_FromNTPBatch(const uint64_t *ntp, uint32_t *unixtime, uint32_t count);
+void DS3231_Epoch_ToTAIBatch(const uint32_t *unixtime, uint8_t tai_utc, uint64_t *tai, uint32_t count);
+void DS3231_Epoch_ToGPSBatch(const uint32_t *unixtime, uint8_t tai_utc, DS3231_GpsTime *gps, uint32_t count);
+void DS3231_Epoch_FromGPSBatch(const DS3231_GpsTime *gps, uint8_t tai_utc, uint32_t *unixtime, uint32_t count);
+void DS3231_Epoch_ToMJDBatch(const uint32_t *unixtime, uint32_t *mjd, uint32_t *sod, uint32_t count);
+void DS3231_Epoch_ToJDBatch(const uint32_t *unixtime, uint64_t *jd, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_EPOCH_H */
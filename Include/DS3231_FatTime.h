@@ -0,0 +1,63 @@
+/**
+ *  @brief     FatFs timestamp provider for the DS3231 library.
+ *  @details   Converts the raw time registers straight into the packed FAT date/time word returned by FatFs's
+ *             get_fattime(), without going through #DS3231_DateTime:\n
+ *             | 31..25 year - 1980 | 24..21 month | 20..16 date | 15..11 hour | 10..5 minute | 4..0 second / 2 |\n
+ *             With #DS3231_USE_CACHE set, calls inside the same second are served from a cache validated with
+ *             HAL_GetTick(), see #DS3231_GetFatTime.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_FATTIME_H
+#define DS3231_FATTIME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+#include "DS3231_RawTime.h"
+
+/*------------------------------------ FAT TIME LAYOUT ------------------------------------------*/
+#define DS3231_FAT_EPOCH            1980
+#define DS3231_FATTIME_FALLBACK     ((1UL << 21) | (1UL << 16))     /* 1980-01-01 00:00:00 */
+
+#ifndef DS3231_FATTIME_PROVIDER
+#define DS3231_FATTIME_PROVIDER     0       /* 1 defines get_fattime() for FatFs in DS3231_FatTime.c */
+#endif
+
+#ifndef DS3231_FATTIME_GUARD_MS
+#define DS3231_FATTIME_GUARD_MS     20      /* Margin for HAL tick error against the RTC second */
+#endif
+
+/**
+ * @brief Converts raw time registers to a FAT date/time word.
+ * @param[in] *raw Pass a pointer to #DS3231_RawTime type variable, the year must lie within 1980 to 2107.
+ * @return FAT date/time word, seconds in 2 second steps.
+ */
+DS3231_INLINE uint32_t DS3231_FatTime_FromRaw(const DS3231_RawTime *raw) {
+    return (uint32_t) (DS3231_RawTime_Year(raw) - DS3231_FAT_EPOCH) << 25
+            | (uint32_t) DS3231_RawTime_Month(raw) << 21
+            | (uint32_t) DS3231_RawTime_Date(raw) << 16
+            | (uint32_t) DS3231_RawTime_Hour(raw) << 11
+            | (uint32_t) DS3231_RawTime_Minute(raw) << 5
+            | (uint32_t) DS3231_RawTime_Second(raw) >> 1;
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+HAL_StatusTypeDef DS3231_GetFatTime(uint32_t *fattime);
+
+#if DS3231_USE_CACHE
+void DS3231_FatTime_Invalidate(void);
+#endif
+
+#if DS3231_FATTIME_PROVIDER
+uint32_t get_fattime(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_FATTIME_H */
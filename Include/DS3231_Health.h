@@ -0,0 +1,80 @@
+/**
+ *  @brief     Background health monitor for the DS3231.
+ *  @details   One task samples STATUS, AGING, the temperature and the time registers in a single 11 byte burst
+ *             starting at 0x0F, the register pointer wraps from 0x12 to 0x00. It checks for OSF, a BSY bit that
+ *             stays set, bus errors, time jumps against HAL_GetTick(), a clock that stopped counting and a
+ *             temperature outside a window, and publishes the result as one 32 bit health word:\n
+ *             | 31..16: temperature in 0.25 degree C | 15..8: anomaly count | 7..0: DS3231_HEALTH_... flags |\n
+ *             Other code reads the word with #DS3231_Health_Get without bus traffic. The sampling period starts
+ *             fast, doubles after every quiet sample up to the slow period and drops back to fast on every new
+ *             anomaly. The time checks need #DS3231_USE_CONVERSIONS. With #DS3231_USE_CACHE or
+ *             #DS3231_USE_ASYNC, time writes through the library are told apart from jumps by
+ *             #DS3231_GetTimeGeneration; without either, such a write is reported as one jump.\n
+ *             The monitor reads through #DS3231_ReadRegisters like any other caller, so the monitor task's bus
+ *             access must be serialized with the other tasks that use the driver, e.g. by the same mutex.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_HEALTH_H
+#define DS3231_HEALTH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ HEALTH WORD ----------------------------------------------*/
+#define DS3231_HEALTH_OSF           0x01    /* Oscillator stop flag set, the time is not trustworthy */
+#define DS3231_HEALTH_BUSY_STUCK    0x02    /* BSY set for #DS3231_HEALTH_BUSY_MS or longer */
+#define DS3231_HEALTH_BUS_ERROR     0x04    /* The last sample failed on the bus, other flags are from before */
+#define DS3231_HEALTH_TIME_JUMP     0x08    /* The time moved unlike HAL_GetTick(), held until back to slow */
+#define DS3231_HEALTH_STALL         0x10    /* The seconds did not change for #DS3231_HEALTH_STALL_MS */
+#define DS3231_HEALTH_TEMPERATURE   0x20    /* Temperature outside the window */
+#define DS3231_HEALTH_FAST          0x40    /* Sampling faster than the slow period after an anomaly */
+#define DS3231_HEALTH_VALID         0x80    /* At least one sample succeeded */
+#define DS3231_HEALTH_FAULTS        0x3F
+
+#define DS3231_HEALTH_FLAGS(w)          ((uint8_t) (w))
+#define DS3231_HEALTH_ANOMALIES(w)      ((uint8_t) ((w) >> 8))
+#define DS3231_HEALTH_TEMPERATURE_Q(w)  ((int16_t) ((w) >> 16))
+
+#ifndef DS3231_HEALTH_BUSY_MS
+#define DS3231_HEALTH_BUSY_MS       1000    /* A conversion takes 200 ms at most */
+#endif
+#ifndef DS3231_HEALTH_STALL_MS
+#define DS3231_HEALTH_STALL_MS      2000
+#endif
+#define DS3231_HEALTH_SAMPLE_LEN    11      /* 0x0F..0x12 and 0x00..0x06 */
+
+typedef struct DS3231_Health {
+    volatile uint32_t Word;     /* Published health word */
+    uint32_t SlowMs;
+    uint32_t FastMs;
+    uint32_t PeriodMs;          /* Current sampling period */
+    uint32_t RefTick;           /* HAL_GetTick() when the seconds last changed */
+    uint32_t RefTime;           /* Unix time at RefTick */
+    uint32_t BusySince;
+    uint32_t Generation;        /* Time writes through the library are not jumps */
+    int16_t TempLow;
+    int16_t TempHigh;
+    uint8_t HasRef;
+    uint8_t Busy;
+} DS3231_Health;
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+void DS3231_Health_Init(DS3231_Health *health, uint32_t slow_ms, uint32_t fast_ms, int16_t temp_low,
+        int16_t temp_high);
+HAL_StatusTypeDef DS3231_Health_Sample(DS3231_Health *health, uint32_t *next_ms);
+
+/* Latest health word, safe to call from any task or interrupt. */
+DS3231_INLINE uint32_t DS3231_Health_Get(const DS3231_Health *health) {
+    return health->Word;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_HEALTH_H */
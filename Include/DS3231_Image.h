@@ -0,0 +1,51 @@
+/**
+ *  @brief     Register image export and import for provisioning many DS3231 boards.
+ *  @details   An image is a versioned blob of the writable registers 0x00 to 0x10 (time, alarms, control,
+ *             status and aging) with a mask of the regions it carries and a CRC-8:\n
+ *             | 0: 'D' | 1: '3' | 2: version | 3: regions | 4..20: registers 0x00..0x10 | 21: CRC-8 of 0..20 |\n
+ *             #DS3231_ImportImage writes the carried regions in as few bursts as possible, a full image in one,
+ *             with the time advanced by the seconds elapsed since the image was taken. The host tool
+ *             ds3231_image builds images and checks them against the simulator.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_IMAGE_H
+#define DS3231_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ IMAGE LAYOUT ---------------------------------------------*/
+#define DS3231_IMAGE_VERSION        1
+#define DS3231_IMAGE_REGS           (DS3231_REG_AGING + 1)              /* Registers 0x00..0x10 */
+#define DS3231_IMAGE_HEADER         4
+#define DS3231_IMAGE_SIZE           (DS3231_IMAGE_HEADER + DS3231_IMAGE_REGS + 1)
+
+/* Regions of the register file an image carries, see #DS3231_ExportImage. */
+#define DS3231_IMAGE_TIME           0x01        /* 0x00..0x06 */
+#define DS3231_IMAGE_ALARM1         0x02        /* 0x07..0x0A */
+#define DS3231_IMAGE_ALARM2         0x04        /* 0x0B..0x0D */
+#define DS3231_IMAGE_CONTROL        0x08        /* 0x0E */
+#define DS3231_IMAGE_STATUS         0x10        /* 0x0F, EN32kHz, importing clears OSF, A2F and A1F */
+#define DS3231_IMAGE_AGING          0x20        /* 0x10 */
+#define DS3231_IMAGE_ALL            0x3F
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+uint8_t DS3231_Image_CRC(const uint8_t *data, uint8_t len);
+void DS3231_Image_Build(const uint8_t *regs, uint8_t regions, uint8_t *image);
+HAL_StatusTypeDef DS3231_Image_Check(const uint8_t *image);
+HAL_StatusTypeDef DS3231_Image_Advance(uint8_t *regs, uint32_t elapsed);
+uint8_t DS3231_Image_Bursts(uint8_t regions);
+
+HAL_StatusTypeDef DS3231_ExportImage(uint8_t *image, uint8_t regions);
+HAL_StatusTypeDef DS3231_ImportImage(const uint8_t *image, uint32_t elapsed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_IMAGE_H */
@@ -0,0 +1,77 @@
+/**
+ *  @brief     Leap second table for UTC, TAI and GPS conversions.
+ *  @details   Unix time and the DS3231 registers count UTC without leap seconds. The table maps unix time to the
+ *             TAI - UTC offset in effect, the tai_utc parameter of the DS3231_Epoch.h converters. Each entry is
+ *             the unix time at which an offset starts, as in the IETF leap-seconds.list file. The table holds the
+ *             leap seconds up to 2017-01-01 built in; a newer list can be loaded on the host with
+ *             DS3231_LeapFile.h or passed in from RAM, e.g. after a firmware or GNSS update.\n
+ *             The table caches the segment between two entries that the last lookup fell into. Times arrive
+ *             mostly in order, so a lookup is one unsigned compare; a time outside the segment binary searches
+ *             the table and moves the cache.\n
+ *             With #DS3231_USE_CONVERSIONS, DS3231_Leap_ToDateTime and DS3231_Leap_FromDateTime convert between
+ *             TAI seconds and #DS3231_DateTime with Second = 60 during an inserted leap second (23:59:60).
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_LEAPSECONDS_H
+#define DS3231_LEAPSECONDS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+#define DS3231_LEAP_BUILTIN_COUNT   28          /* 1972-01-01 (10 s) to 2017-01-01 (37 s) */
+#define DS3231_LEAP_BUILTIN_EXPIRES 1814140800UL    /* 2027-06-28, from leap-seconds.list after Bulletin C 72 */
+
+typedef struct DS3231_LeapEntry {
+    uint32_t Unix;              /* Unix time the offset starts at, the second after 23:59:60 */
+    uint8_t TaiUtc;             /* TAI - UTC in seconds from then on */
+} DS3231_LeapEntry;
+
+typedef struct DS3231_LeapTable {
+    const DS3231_LeapEntry *Entries;    /* Sorted by Unix, at least one entry */
+    uint32_t Expires;           /* Unix time after which a newer list may hold another leap second */
+    uint32_t SegStart;          /* Cached segment [SegStart, SegStart + SegLength) */
+    uint32_t SegLength;
+    uint8_t SegTaiUtc;          /* Offset in the cached segment */
+    uint8_t Segment;            /* Entry the cached segment starts at */
+    uint8_t Count;
+} DS3231_LeapTable;
+
+extern const DS3231_LeapEntry DS3231_LeapBuiltin[DS3231_LEAP_BUILTIN_COUNT];
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+HAL_StatusTypeDef DS3231_Leap_Init(DS3231_LeapTable *table, const DS3231_LeapEntry *entries, uint8_t count,
+        uint32_t expires);
+uint8_t DS3231_Leap_Seek(DS3231_LeapTable *table, uint32_t unixtime);
+uint8_t DS3231_Leap_FromTAI(DS3231_LeapTable *table, uint32_t tai, uint32_t *unixtime);
+#if DS3231_USE_CONVERSIONS
+void DS3231_Leap_ToDateTime(DS3231_LeapTable *table, uint32_t tai, DS3231_DateTime *dt);
+HAL_StatusTypeDef DS3231_Leap_FromDateTime(DS3231_LeapTable *table, DS3231_DateTime *dt, uint32_t *tai);
+#endif
+
+/* TAI - UTC at a unix time, 10 s before 1972. One compare while the time stays in the cached segment. */
+DS3231_INLINE uint8_t DS3231_Leap_TaiUtc(DS3231_LeapTable *table, uint32_t unixtime) {
+    if (unixtime - table->SegStart < table->SegLength)
+        return table->SegTaiUtc;
+    return DS3231_Leap_Seek(table, unixtime);
+}
+
+/* TAI seconds since 1970-01-01 00:00:00 TAI, the upper half of DS3231_Epoch_UnixToTAI. */
+DS3231_INLINE uint32_t DS3231_Leap_ToTAI(DS3231_LeapTable *table, uint32_t unixtime) {
+    return unixtime + DS3231_Leap_TaiUtc(table, unixtime);
+}
+
+/* The table may be missing a leap second announced after it was published. */
+DS3231_INLINE uint8_t DS3231_Leap_Expired(const DS3231_LeapTable *table, uint32_t unixtime) {
+    return unixtime >= table->Expires;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_LEAPSECONDS_H */
@@ -0,0 +1,98 @@
+/**
+ *  @brief     Time-indexed binary log format for DS3231 stamped records.
+ *  @details   A log is a sequence of fixed size blocks followed by an optional sparse index footer. All multi-byte
+ *             fields are little endian.\n
+ *             Block header, #DS3231_LOG_HEADER_SIZE bytes:\n
+ *             | 0 magic "DSLB" | 4 version | 6 header size | 8 block size | 12 sequence | 16 records | 18 record size |
+ *             20 min unix time | 24 max unix time | 28 reserved |\n
+ *             Records follow the header back to back. Each record starts with its 4 byte unix time, e.g. from
+ *             #DS3231_ToUnixTime, followed by the payload. Records must be appended in time order.\n
+ *             Footer, written once when the log is closed:\n
+ *             | entries of { min unix time, block number } for every stride-th block | magic "DSLI" | entries |
+ *             stride | block size |\n
+ *             A reader can binary search the footer, then the block headers, then the records of one block,
+ *             without parsing anything else. Logs without a footer, e.g. after a power cut, are still readable.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_LOG_H
+#define DS3231_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ LOG LAYOUT -----------------------------------------------*/
+#define DS3231_LOG_BLOCK_MAGIC      0x424C5344UL    /* "DSLB" */
+#define DS3231_LOG_INDEX_MAGIC      0x494C5344UL    /* "DSLI" */
+#define DS3231_LOG_VERSION          1
+#define DS3231_LOG_HEADER_SIZE      32
+#define DS3231_LOG_TRAILER_SIZE     16
+#define DS3231_LOG_ENTRY_SIZE       8
+
+#define DS3231_LOG_OFS_MAGIC        0
+#define DS3231_LOG_OFS_VERSION      4
+#define DS3231_LOG_OFS_HEADER_SIZE  6
+#define DS3231_LOG_OFS_BLOCK_SIZE   8
+#define DS3231_LOG_OFS_SEQUENCE     12
+#define DS3231_LOG_OFS_RECORDS      16
+#define DS3231_LOG_OFS_RECORD_SIZE  18
+#define DS3231_LOG_OFS_MIN_TIME     20
+#define DS3231_LOG_OFS_MAX_TIME     24
+
+typedef struct DS3231_LogBlock {
+    uint8_t *Buffer;
+    uint32_t Size;              /* Block size in bytes */
+    uint16_t RecordSize;        /* Bytes per record, time included */
+    uint16_t Records;
+    uint16_t Capacity;          /* Records that fit in the block */
+} DS3231_LogBlock;
+
+typedef struct DS3231_LogIndex {
+    uint8_t *Buffer;            /* Room for the footer, see #DS3231_LogIndex_Size */
+    uint32_t Capacity;          /* Entries that fit in Buffer */
+    uint32_t Entries;
+    uint32_t Stride;            /* One entry per Stride blocks */
+    uint32_t BlockSize;
+} DS3231_LogIndex;
+
+/*------------------------------------ LITTLE ENDIAN FIELDS -------------------------------------*/
+DS3231_INLINE uint16_t DS3231_LogGet16(const uint8_t *p) {
+    return (uint16_t) (p[0] | p[1] << 8);
+}
+
+DS3231_INLINE uint32_t DS3231_LogGet32(const uint8_t *p) {
+    return (uint32_t) p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+DS3231_INLINE void DS3231_LogPut16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t) v;
+    p[1] = (uint8_t) (v >> 8);
+}
+
+DS3231_INLINE void DS3231_LogPut32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t) v;
+    p[1] = (uint8_t) (v >> 8);
+    p[2] = (uint8_t) (v >> 16);
+    p[3] = (uint8_t) (v >> 24);
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+HAL_StatusTypeDef DS3231_LogBlock_Begin(DS3231_LogBlock *blk, uint8_t *buffer, uint32_t size, uint16_t record_size,
+        uint32_t sequence);
+uint8_t DS3231_LogBlock_Append(DS3231_LogBlock *blk, uint32_t unixtime, const uint8_t *payload);
+
+uint32_t DS3231_LogIndex_Size(uint32_t blocks, uint32_t stride);
+HAL_StatusTypeDef DS3231_LogIndex_Begin(DS3231_LogIndex *idx, uint8_t *buffer, uint32_t size, uint32_t stride,
+        uint32_t block_size);
+HAL_StatusTypeDef DS3231_LogIndex_Add(DS3231_LogIndex *idx, const uint8_t *block);
+uint32_t DS3231_LogIndex_Finish(DS3231_LogIndex *idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_LOG_H */
@@ -0,0 +1,57 @@
+/**
+ *  @brief     Packed 32-bit timestamp for the DS3231 library.
+ *  @details   Stores a full date and time with one second resolution in a uint32_t, most significant field
+ *             first, so that two packed times compare with a single integer compare:\n
+ *             | 31..26 year - #DS3231_PACKED_EPOCH | 25..22 month | 21..17 date | 16..12 hour | 11..6 minute | 5..0 second |\n
+ *             The day of week and the oscillator flag are not stored, the day of week is recomputed on unpacking.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_PACKED_H
+#define DS3231_PACKED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ PACKED LAYOUT --------------------------------------------*/
+#ifndef DS3231_PACKED_EPOCH
+#define DS3231_PACKED_EPOCH     2000        /* First representable year, 64 years are covered */
+#endif
+#define DS3231_PACKED_LAST_YEAR (DS3231_PACKED_EPOCH + 63)
+
+#define DS3231_PACKED_SECOND_POS    0
+#define DS3231_PACKED_MINUTE_POS    6
+#define DS3231_PACKED_HOUR_POS      12
+#define DS3231_PACKED_DATE_POS      17
+#define DS3231_PACKED_MONTH_POS     22
+#define DS3231_PACKED_YEAR_POS      26
+
+#define DS3231_PACKED_SECOND(p)     (((p) >> DS3231_PACKED_SECOND_POS) & 0x3F)
+#define DS3231_PACKED_MINUTE(p)     (((p) >> DS3231_PACKED_MINUTE_POS) & 0x3F)
+#define DS3231_PACKED_HOUR(p)       (((p) >> DS3231_PACKED_HOUR_POS) & 0x1F)
+#define DS3231_PACKED_DATE(p)       (((p) >> DS3231_PACKED_DATE_POS) & 0x1F)
+#define DS3231_PACKED_MONTH(p)      (((p) >> DS3231_PACKED_MONTH_POS) & 0x0F)
+#define DS3231_PACKED_YEAR(p)       ((((p) >> DS3231_PACKED_YEAR_POS) & 0x3F) + DS3231_PACKED_EPOCH)
+
+typedef uint32_t DS3231_Packed;
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+#if DS3231_USE_CONVERSIONS
+HAL_StatusTypeDef DS3231_ToPacked(DS3231_DateTime *dt, DS3231_Packed *packed);
+void DS3231_FromPacked(DS3231_Packed *packed, DS3231_DateTime *dt);
+
+HAL_StatusTypeDef DS3231_PackRegisters(uint8_t *regs, DS3231_Packed *packed);
+uint8_t DS3231_UnpackRegisters(DS3231_Packed *packed, DS3231_HourMode mode, uint8_t *regs);
+
+HAL_StatusTypeDef DS3231_GetPacked(DS3231_Packed *packed);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_PACKED_H */
@@ -0,0 +1,102 @@
+/**
+ *  @brief     Zero-copy view of the DS3231 time registers with lazy field decoding.
+ *  @details   #DS3231_RawTime is the 7 byte image of registers 0x00 to 0x06 exactly as the device returns it. A
+ *             buffer filled by DMA can be viewed in place with #DS3231_RAWTIME, no copy is made. Each accessor
+ *             decodes only its own field, so a rollover check that needs the minute costs one BCD decode instead
+ *             of the seven done by #DS3231_GetDateTime.\n
+ *             BCD preserves the order of the digits it encodes, so #DS3231_RawTime_Compare orders two raw times
+ *             without decoding any field.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_RAWTIME_H
+#define DS3231_RAWTIME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ RAW TIME LAYOUT ------------------------------------------*/
+typedef struct DS3231_RawTime {
+    uint8_t Regs[7];            /* Registers #DS3231_REG_SECOND to #DS3231_REG_YEAR, BCD as read */
+} DS3231_RawTime;
+
+/* Views a 7 byte register buffer, e.g. a DMA receive buffer, as a #DS3231_RawTime without copying. */
+#define DS3231_RAWTIME(buffer)  ((const DS3231_RawTime *) (const void *) (buffer))
+
+/*------------------------------------ FIELD ACCESSORS ------------------------------------------*/
+DS3231_INLINE uint8_t DS3231_RawTime_Decode(uint8_t bcd) {
+    return (uint8_t) ((bcd >> 4) * 10 + (bcd & 0x0F));
+}
+
+DS3231_INLINE uint8_t DS3231_RawTime_Second(const DS3231_RawTime *raw) {
+    return DS3231_RawTime_Decode(raw->Regs[0] & 0x7F);
+}
+
+DS3231_INLINE uint8_t DS3231_RawTime_Minute(const DS3231_RawTime *raw) {
+    return DS3231_RawTime_Decode(raw->Regs[1] & 0x7F);
+}
+
+/* 0..23 in either hour mode, as in #DS3231_GetDateTime. */
+DS3231_INLINE uint8_t DS3231_RawTime_Hour(const DS3231_RawTime *raw) {
+    return DS3231_Hour_Decode(raw->Regs[2]);
+}
+
+DS3231_INLINE uint8_t DS3231_RawTime_Day(const DS3231_RawTime *raw) {
+    return raw->Regs[3] & 0x07;
+}
+
+DS3231_INLINE uint8_t DS3231_RawTime_Date(const DS3231_RawTime *raw) {
+    return DS3231_RawTime_Decode(raw->Regs[4] & 0x3F);
+}
+
+DS3231_INLINE uint8_t DS3231_RawTime_Month(const DS3231_RawTime *raw) {
+    return DS3231_RawTime_Decode(raw->Regs[5] & 0x1F);
+}
+
+/* The century bit adds 100 years. */
+DS3231_INLINE uint16_t DS3231_RawTime_Year(const DS3231_RawTime *raw) {
+    return (uint16_t) (DS3231_RawTime_Decode(raw->Regs[6]) + 2000U + (raw->Regs[5] >> DS3231_CENTURY) * 100U);
+}
+
+/*------------------------------------ COMPARISON -----------------------------------------------*/
+/* Century, year, month and date as one BCD ordered key. */
+DS3231_INLINE uint32_t DS3231_RawTime_DateKey(const DS3231_RawTime *raw) {
+    return (uint32_t) (raw->Regs[5] >> DS3231_CENTURY) << 24 | (uint32_t) raw->Regs[6] << 16
+            | (uint32_t) (raw->Regs[5] & 0x1F) << 8 | (uint32_t) (raw->Regs[4] & 0x3F);
+}
+
+/* Hour, minute and second as one ordered key, the hour decoded since 12 hour mode does not sort as BCD. */
+DS3231_INLINE uint32_t DS3231_RawTime_TimeKey(const DS3231_RawTime *raw) {
+    return (uint32_t) DS3231_Hour_Decode(raw->Regs[2]) << 16 | (uint32_t) (raw->Regs[1] & 0x7F) << 8
+            | (uint32_t) (raw->Regs[0] & 0x7F);
+}
+
+/**
+ * @brief Orders two raw times without decoding them.
+ * @param[in] *a Pass a pointer to #DS3231_RawTime type variable.
+ * @param[in] *b Pass a pointer to #DS3231_RawTime type variable.
+ * @return -1, 0 or 1 when a is earlier than, equal to or later than b.
+ * @note The day of week is ignored. The hour is decoded, either hour mode works.
+ */
+DS3231_INLINE int DS3231_RawTime_Compare(const DS3231_RawTime *a, const DS3231_RawTime *b) {
+    uint32_t ka = DS3231_RawTime_DateKey(a), kb = DS3231_RawTime_DateKey(b);
+    if (ka == kb) {
+        ka = DS3231_RawTime_TimeKey(a);
+        kb = DS3231_RawTime_TimeKey(b);
+    }
+    return (ka > kb) - (ka < kb);
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+HAL_StatusTypeDef DS3231_GetRawTime(DS3231_RawTime *raw);
+void DS3231_RawTime_ToDateTime(const DS3231_RawTime *raw, DS3231_DateTime *dt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_RAWTIME_H */
@@ -0,0 +1,44 @@
+/**
+ *  @brief     Battery-backed scratchpad in the Alarm 2 registers of the DS3231.
+ *  @details   On boards that do not use Alarm 2, its three registers keep 16 bits of state across MCU power loss
+ *             for as long as the RTC runs on its battery, e.g. a boot counter or a sync generation:\n
+ *             | 0x0B: 0 1 1 check[4..0] | 0x0C: data[15..8] | 0x0D: data[7..0] |\n
+ *             The minutes byte 0x6x/0x7x with A2M2 clear is never matched by the time registers, so the image
+ *             cannot raise A2F. The 5-bit check code is a CRC over the data, a fresh or reprogrammed alarm fails
+ *             it. Reads and writes refuse with HAL_ERROR while A2IE is set.
+ *  @note      #DS3231_SetAlarm2 and #DS3231_ApplyConfig overwrite the scratchpad, #DS3231_SetHourMode leaves it
+ *             alone. Do not use it if Alarm 2 is polled through A2F with the interrupt disabled, that use cannot
+ *             be detected.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_SCRATCHPAD_H
+#define DS3231_SCRATCHPAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ SCRATCHPAD LAYOUT ----------------------------------------*/
+#define DS3231_SCRATCHPAD_REG       DS3231_REG_A2_MINUTE
+#define DS3231_SCRATCHPAD_LEN       3
+#define DS3231_SCRATCHPAD_MARK      0x60    /* A2M2 clear, minutes 0x60..0x7F never match */
+#define DS3231_SCRATCHPAD_MARK_MASK 0xE0
+#define DS3231_SCRATCHPAD_CHECK     0x1F
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+uint8_t DS3231_Scratchpad_Check(uint16_t data);
+void DS3231_Scratchpad_Pack(uint16_t data, uint8_t *regs);
+HAL_StatusTypeDef DS3231_Scratchpad_Unpack(const uint8_t *regs, uint16_t *data);
+
+HAL_StatusTypeDef DS3231_Scratchpad_Read(uint16_t *data);
+HAL_StatusTypeDef DS3231_Scratchpad_Write(uint16_t data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_SCRATCHPAD_H */
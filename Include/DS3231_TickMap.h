@@ -0,0 +1,75 @@
+/**
+ *  @brief     Deferred conversion of captured counter ticks to unix time for the DS3231 library.
+ *  @details   ISRs only store the value of a free running counter, e.g. the DWT cycle counter, a timer or SysTick.
+ *             A background task anchors the counter to the RTC from time to time and later resolves batches of
+ *             captured ticks to unix time in one go. Consecutive anchors form piecewise linear segments, so the
+ *             counter's frequency error and drift are taken out between anchors; a tick is found in O(log n)
+ *             of the #DS3231_TICKMAP_ANCHORS anchors kept in a ring.\n
+ *             Times are unix seconds in the upper and the fraction of the second in the lower 32 bits of a
+ *             uint64_t, see #DS3231_TICKMAP_SECONDS.\n
+ *             Counters narrower than 32 bits and wraparound are handled by extending every tick to 64 bits
+ *             against the newest tick seen. A captured tick must therefore be resolved less than one counter
+ *             period after it was taken, and the map must see a tick (anchor or resolve) at least once a period.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_TICKMAP_H
+#define DS3231_TICKMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/*------------------------------------ TICK MAP LAYOUT ------------------------------------------*/
+#ifndef DS3231_TICKMAP_ANCHORS
+#define DS3231_TICKMAP_ANCHORS      16      /* Anchors kept, the oldest is dropped when full */
+#endif
+
+#define DS3231_TICKMAP_SECONDS(t)   ((uint32_t) ((t) >> 32))
+#define DS3231_TICKMAP_FRACTION(t)  ((uint32_t) (t))
+#define DS3231_TICKMAP_TIME(s, f)   ((uint64_t) (s) << 32 | (uint32_t) (f))
+
+typedef struct DS3231_TickAnchor {
+    uint64_t Tick;              /* Extended counter value */
+    uint64_t Time;              /* Unix time, 32.32 fixed point */
+    uint64_t Rate;              /* Time per tick up to the next anchor, 32.32 fixed point in 2^-32 s */
+} DS3231_TickAnchor;
+
+typedef struct DS3231_TickMap {
+    DS3231_TickAnchor Anchors[DS3231_TICKMAP_ANCHORS];
+    uint32_t Head;              /* Ring index of the oldest anchor */
+    uint32_t Count;
+    uint32_t Mask;              /* Counter range - 1 */
+    uint64_t NominalRate;       /* Used until two anchors exist */
+    uint64_t LastTick;          /* Newest extended tick seen */
+    uint32_t LastRaw;
+    uint8_t Started;
+    /* State of #DS3231_TickMap_Poll */
+    uint64_t PollTick;
+    uint8_t PollSecond;
+    uint8_t PollValid;
+#if DS3231_USE_CACHE
+    uint32_t Generation;
+#endif
+} DS3231_TickMap;
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+void DS3231_TickMap_Init(DS3231_TickMap *map, uint32_t tick_hz, uint8_t tick_bits);
+void DS3231_TickMap_Reset(DS3231_TickMap *map);
+uint64_t DS3231_TickMap_Extend(DS3231_TickMap *map, uint32_t now);
+void DS3231_TickMap_AddAnchor(DS3231_TickMap *map, uint32_t tick, uint64_t time);
+HAL_StatusTypeDef DS3231_TickMap_Resolve(DS3231_TickMap *map, uint32_t now, const uint32_t *ticks, uint64_t *times,
+        uint32_t count);
+
+#if DS3231_USE_CONVERSIONS
+HAL_StatusTypeDef DS3231_TickMap_Poll(DS3231_TickMap *map, uint32_t (*read_tick)(void), uint32_t max_window);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_TICKMAP_H */
@@ -0,0 +1,50 @@
+/**
+ *  @brief     Compile-time feature selection for the DS3231 library.
+ *  @details   Every switch can be overridden with a compiler define (-DDS3231_USE_ALARMS=0) or by editing this
+ *             file. A disabled feature compiles out completely, its functions and tables are not built.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_CONFIG_H
+#define DS3231_CONFIG_H
+
+/*------------------------------------ FEATURE SWITCHES -----------------------------------------*/
+#ifndef DS3231_USE_ALARMS
+#define DS3231_USE_ALARMS               1   /* Alarm 1 and alarm 2 configuration, interrupt enables and flags */
+#endif
+
+#ifndef DS3231_USE_TEMPERATURE
+#define DS3231_USE_TEMPERATURE          1   /* Temperature readout in 0.25 degree C steps */
+#endif
+
+#ifndef DS3231_USE_FLOAT_TEMPERATURE
+#define DS3231_USE_FLOAT_TEMPERATURE    1   /* DS3231_GetTemperature, pulls in soft-float on FPU-less parts */
+#endif
+
+#ifndef DS3231_USE_CONVERSIONS
+#define DS3231_USE_CONVERSIONS          1   /* Unix time and packed timestamp conversions with their tables */
+#endif
+
+#ifndef DS3231_USE_INLINE
+#define DS3231_USE_INLINE               0   /* Header-only static inline BCD helpers, see DS3231_inline.h */
+#endif
+
+#ifndef DS3231_USE_ASYNC
+#define DS3231_USE_ASYNC                0   /* Services that share the device between tasks */
+#endif
+
+#ifndef DS3231_USE_CACHE
+#define DS3231_USE_CACHE                0   /* Cached time reads served without bus traffic */
+#endif
+
+#ifndef DS3231_USE_STATS
+#define DS3231_USE_STATS                0   /* Bus transaction and error counters */
+#endif
+
+#if DS3231_USE_FLOAT_TEMPERATURE && !DS3231_USE_TEMPERATURE
+#undef DS3231_USE_FLOAT_TEMPERATURE
+#define DS3231_USE_FLOAT_TEMPERATURE    0
+#endif
+
+#endif /* DS3231_CONFIG_H */
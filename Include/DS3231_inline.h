@@ -0,0 +1,134 @@
+/**
+ *  @brief     Header-only register primitives for the DS3231 library.
+ *  @details   Bit-field accessors for the CONTROL and STATUS registers work on a byte read once, e.g. with
+ *             #DS3231_ReadControlStatus, so several fields can be tested without further bus traffic. The hour
+ *             register helpers decode and encode both 12 and 24 hour mode without branches.\n
+ *             With #DS3231_USE_INLINE set, DS3231_DecodeBCD and DS3231_EncodeBCD are also defined here as
+ *             forced-inline functions so that calls are inlined and constant folded without LTO.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_INLINE_H
+#define DS3231_INLINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__)
+#define DS3231_INLINE   static inline __attribute__((always_inline))   /* -Os would otherwise keep calls */
+#else
+#define DS3231_INLINE   static inline
+#endif
+
+/*------------------------------------ BCD ------------------------------------------------------*/
+#if DS3231_USE_INLINE
+DS3231_INLINE uint8_t DS3231_DecodeBCD(uint8_t bin) {
+    return (uint8_t) ((bin >> 4) * 10 + (bin & 0x0F));
+}
+
+DS3231_INLINE uint8_t DS3231_EncodeBCD(uint8_t dec) {
+    return (uint8_t) (dec + (dec / 10) * 6);
+}
+#endif
+
+/*------------------------------------ REGISTER BITS --------------------------------------------*/
+DS3231_INLINE uint8_t DS3231_GetBit(uint8_t reg, uint8_t bit) {
+    return (reg >> bit) & 0x01;
+}
+
+DS3231_INLINE uint8_t DS3231_SetBit(uint8_t reg, uint8_t bit, uint8_t value) {
+    return (uint8_t) ((reg & ~(1U << bit)) | ((value & 0x01U) << bit));
+}
+
+/*------------------------------------ HOUR REGISTERS -------------------------------------------*/
+/**
+ * @brief Decodes a time or alarm hour register in either mode to 0..23, bit 7 is ignored.
+ * @details Branch-free: 12 hour mode masks the PM bit out of the tens digit, maps 12 to 0 and adds 12 for PM,
+ * all with flags computed from the register, so 24 hour registers take the same few instructions. Constant
+ * shifts only, so loops over many registers vectorize.
+ * @param[in] reg Hour register as read.
+ * @return Hour of the day, 0..23.
+ */
+DS3231_INLINE uint8_t DS3231_Hour_Decode(uint8_t reg) {
+    const uint8_t h12 = (reg >> DS3231_12_24) & 0x01;
+    const uint8_t bcd = reg & (0x3F ^ (h12 << DS3231_PM));
+    const uint8_t hour = (uint8_t) ((bcd >> 4) * 10 + (bcd & 0x0F));
+    const uint8_t pm = (reg >> DS3231_PM) & h12;
+    return (uint8_t) (hour + 12 * pm - 12 * (h12 & (bcd == 0x12)));
+}
+
+/**
+ * @brief Encodes 0..23 as an hour register in the given mode, bit 7 clear.
+ * @param[in] hour Hour of the day, 0..23.
+ * @param[in] mode #DS3231_24H or #DS3231_12H.
+ * @return Hour register value.
+ */
+DS3231_INLINE uint8_t DS3231_Hour_Encode(uint8_t hour, DS3231_HourMode mode) {
+    const uint8_t h12 = (uint8_t) mode & 0x01;
+    const uint8_t pm = (uint8_t) (hour >= 12) & h12;
+    uint8_t h = (uint8_t) (hour - 12 * pm);
+    h = (uint8_t) (h + 12 * (h12 & (h == 0)));
+    return (uint8_t) (h + 6 * ((h >= 10) + (h >= 20)) + (h12 << DS3231_12_24) + (pm << DS3231_PM));
+}
+
+DS3231_INLINE DS3231_HourMode DS3231_Hour_Mode(uint8_t reg) {
+    return (DS3231_HourMode) DS3231_GetBit(reg, DS3231_12_24);
+}
+
+/*------------------------------------ CONTROL ACCESSORS ----------------------------------------*/
+DS3231_INLINE DS3231_State DS3231_Control_Oscillator(uint8_t control) {
+    return (DS3231_State) !DS3231_GetBit(control, DS3231_EOSC);
+}
+
+DS3231_INLINE DS3231_State DS3231_Control_BatterySquareWave(uint8_t control) {
+    return (DS3231_State) DS3231_GetBit(control, DS3231_BBSQW);
+}
+
+DS3231_INLINE DS3231_State DS3231_Control_Converting(uint8_t control) {
+    return (DS3231_State) DS3231_GetBit(control, DS3231_CONV);
+}
+
+DS3231_INLINE DS3231_Rate DS3231_Control_Rate(uint8_t control) {
+    return (DS3231_Rate) ((control >> DS3231_RS1) & 0x03);
+}
+
+DS3231_INLINE DS3231_InterruptMode DS3231_Control_InterruptMode(uint8_t control) {
+    return (DS3231_InterruptMode) DS3231_GetBit(control, DS3231_INTCN);
+}
+
+DS3231_INLINE DS3231_State DS3231_Control_Alarm1IntEn(uint8_t control) {
+    return (DS3231_State) DS3231_GetBit(control, DS3231_A1IE);
+}
+
+DS3231_INLINE DS3231_State DS3231_Control_Alarm2IntEn(uint8_t control) {
+    return (DS3231_State) DS3231_GetBit(control, DS3231_A2IE);
+}
+
+/*------------------------------------ STATUS ACCESSORS -----------------------------------------*/
+DS3231_INLINE DS3231_State DS3231_Status_OscillatorStopped(uint8_t status) {
+    return (DS3231_State) DS3231_GetBit(status, DS3231_OSF);
+}
+
+DS3231_INLINE DS3231_State DS3231_Status_32kHzEnabled(uint8_t status) {
+    return (DS3231_State) DS3231_GetBit(status, DS3231_EN32KHZ);
+}
+
+DS3231_INLINE DS3231_State DS3231_Status_Busy(uint8_t status) {
+    return (DS3231_State) DS3231_GetBit(status, DS3231_BSY);
+}
+
+DS3231_INLINE DS3231_State DS3231_Status_Alarm1Flag(uint8_t status) {
+    return (DS3231_State) DS3231_GetBit(status, DS3231_A1F);
+}
+
+DS3231_INLINE DS3231_State DS3231_Status_Alarm2Flag(uint8_t status) {
+    return (DS3231_State) DS3231_GetBit(status, DS3231_A2F);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_INLINE_H */
@@ -6,16 +6,115 @@
  */
 
 #include "DS3231.h"
+#include "DS3231_calendar.h"
 #include "main.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-static const uint8_t days_in_month[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-static const uint8_t dow[12] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+/* Bounds of registers 0x00..0x06 as set from a #DS3231_DateTime, the date bound comes from the month. */
+static const uint8_t field_min[7] = { 0, 0, 0, 1, 1, 1, 0 };
+static const uint8_t field_max[7] = { 59, 59, 23, 7, 31, 12, 99 };
+static const uint8_t days_in_month[16] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0 };   // By month 1..12
 
 static I2C_HandleTypeDef *DS3231_device;
+static DS3231_HourMode DS3231_hour_mode;   /* Mode of the time registers as last read or written */
+
+#if DS3231_USE_STATS
+static DS3231_Stats DS3231_stats;
+#endif
+
+#if DS3231_USE_CACHE || DS3231_USE_ASYNC
+static volatile uint32_t DS3231_time_generation;
+#endif
+
+#if DS3231_USE_ASYNC
+/* The one time read in flight and its result, shared by every caller of DS3231_GetDateTime. */
+static struct {
+    const DS3231_AsyncPort *Port;
+    uint32_t FreshMs;           /* Results younger than this are served again, 0 only shares the read in flight */
+    uint32_t Sequence;          /* Bumped when a read completes */
+    uint32_t Generation;        /* DS3231_time_generation the result was read under */
+    uint32_t Tick;              /* HAL_GetTick() when the result was read */
+    uint8_t InFlight;
+    uint8_t Fresh;
+    HAL_StatusTypeDef Status;
+    DS3231_DateTime Result;
+} DS3231_flight;
+#endif
+
+#if DS3231_USE_ALARMS
+#define DS3231_CONFIG_FIRST     DS3231_REG_A1_SECOND
+#else
+#define DS3231_CONFIG_FIRST     DS3231_REG_CONTROL
+#endif
+#define DS3231_CONFIG_LEN       (DS3231_REG_AGING - DS3231_CONFIG_FIRST + 1)
+#define DS3231_CONFIG_MERGE_GAP 2       /* Rewriting this many unchanged bytes costs less than another write */
+
+/*------------------------------------ REGISTER IMAGES ------------------------------------------*/
+#if DS3231_USE_ALARMS
+static void DS3231_EncodeAlarm1(const D3231_Alarm1 *A1_st, uint8_t data[4]) {
+    uint8_t A1M1 = (A1_st->Mode & 0x01) << 7;   // Seconds bit 7.
+    uint8_t A1M2 = (A1_st->Mode & 0x02) << 6;   // Minutes bit 7.
+    uint8_t A1M3 = (A1_st->Mode & 0x04) << 5;   // Hour bit 7.
+    uint8_t A1M4 = (A1_st->Mode & 0x08) << 4;   // Day/Date bit 7.
+    uint8_t DY_DT = (A1_st->Mode & 0x10) << 2;  // Day/Date bit 6. Date when 0, day of week when 1.
+    data[0] = DS3231_EncodeBCD(A1_st->Seconds) | A1M1;
+    data[1] = DS3231_EncodeBCD(A1_st->Minutes) | A1M2;
+    data[2] = DS3231_Hour_Encode(A1_st->Hours, DS3231_hour_mode) | A1M3;
+    data[3] = DS3231_EncodeBCD(A1_st->DayDate) | DY_DT | A1M4;
+}
+
+/**
+ * @brief Decodes alarm 1 registers 0x07..0x0A as read from the device.
+ * @param[in] data Pass a pointer to 4 bytes.
+ * @param[out] *A1_st Pass a pointer to a #D3231_Alarm1 structure. IntEn, which lives in the CONTROL register,
+ * is left as it is.
+ */
+void DS3231_DecodeAlarm1(const uint8_t data[4], D3231_Alarm1 *A1_st) {
+    uint8_t Mode = (data[0] & 0x80) >> 7    // A1M1
+                 | (data[1] & 0x80) >> 6    // A1M2
+                 | (data[2] & 0x80) >> 5    // A1M3
+                 | (data[3] & 0x80) >> 4    // A1M4
+                 | (data[3] & 0x40) >> 2;   // DY_DT
+    A1_st->Mode = Mode;
+    A1_st->Seconds = DS3231_DecodeBCD(data[0] & 0x7F);
+    A1_st->Minutes = DS3231_DecodeBCD(data[1] & 0x7F);
+    A1_st->Hours = DS3231_Hour_Decode(data[2]);
+    uint8_t DayDate = (data[3] & 0x40) >> 6;
+    if (DayDate)
+        A1_st->DayDate = DS3231_DecodeBCD(data[3] & 0x0F);
+    else
+        A1_st->DayDate = DS3231_DecodeBCD(data[3] & 0x3F);
+}
+
+static void DS3231_EncodeAlarm2(const D3231_Alarm2 *A2_st, uint8_t data[3]) {
+    uint8_t A2M2 = (A2_st->Mode & 0x01) << 7; // Minutes bit 7.
+    uint8_t A2M3 = (A2_st->Mode & 0x02) << 6; // Hour bit 7.
+    uint8_t A2M4 = (A2_st->Mode & 0x04) << 5; // Day/Date bit 7.
+    uint8_t DY_DT = (A2_st->Mode & 0x08) << 3; // Day/Date bit 6. Date when 0, day of week when 1.
+    data[0] = DS3231_EncodeBCD(A2_st->Minutes) | A2M2;
+    data[1] = DS3231_Hour_Encode(A2_st->Hours, DS3231_hour_mode) | A2M3;
+    data[2] = DS3231_EncodeBCD(A2_st->DayDate) | DY_DT | A2M4;
+}
+
+/* Everything but IntEn, which lives in the CONTROL register. */
+static void DS3231_DecodeAlarm2(const uint8_t data[3], D3231_Alarm2 *A2_st) {
+    uint8_t Mode = (data[0] & 0x80) >> 7    // A2M2
+                 | (data[1] & 0x80) >> 6    // A2M3
+                 | (data[2] & 0x80) >> 5    // A2M4
+                 | (data[2] & 0x40) >> 3;   // DY_DT
+    A2_st->Mode = Mode;
+    A2_st->Minutes = DS3231_DecodeBCD(data[0] & 0x7F);
+    A2_st->Hours = DS3231_Hour_Decode(data[1]);
+    uint8_t DayDate = (data[2] & 0x40) >> 6;
+    if (DayDate)
+        A2_st->DayDate = DS3231_DecodeBCD(data[2] & 0x0F);
+    else
+        A2_st->DayDate = DS3231_DecodeBCD(data[2] & 0x3F);
+}
+#endif
 
 /**
  * @brief Initializes the DS3231 module.
@@ -24,14 +123,35 @@ static I2C_HandleTypeDef *DS3231_device;
  * 			Disable both the Alarm 1 (A1IE) and Alarm 2 (A2IE) interrupts\n
  * 			<!-- Set Interrupt pin function (INTCN) as alarm interrupt.\n -->
  * 			Clear both the Alarm 1 flag (A1F) and Alarm 2 flag (A2F)\n
- * 			Disable the battery backed square wave (BBSQW) option..
+ * 			Disable the battery backed square wave (BBSQW) option..\n
+ * 			Read the hour mode of the time registers, see #DS3231_SetHourMode.
  * @param[in] *i2cHandle Pass the I2C handle pointer.
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  * @note Calling this function will change the interrupt pin function (INTCN) to alarm interrupt mode.
  */
 HAL_StatusTypeDef DS3231_Init(I2C_HandleTypeDef *i2cHandle) {
     HAL_StatusTypeDef status;
+    uint8_t reg;
     DS3231_device = i2cHandle;
+    // A board may have been left in 12 hour mode, later writes have to keep it.
+    status = DS3231_ReadRegister(DS3231_REG_HOUR, &reg);
+    if (status != HAL_OK)
+        return status;
+    DS3231_hour_mode = DS3231_Hour_Mode(reg);
+#if !DS3231_USE_ALARMS
+    status = DS3231_ReadRegister(DS3231_REG_CONTROL, &reg);
+    if (status != HAL_OK)
+        return status;
+    reg = (reg & ~((1 << DS3231_A1IE) | (1 << DS3231_A2IE))) | (1 << DS3231_INTCN);
+    status = DS3231_WriteRegister(DS3231_REG_CONTROL, &reg);
+    if (status != HAL_OK)
+        return status;
+    status = DS3231_ReadRegister(DS3231_REG_STATUS, &reg);
+    if (status != HAL_OK)
+        return status;
+    reg &= ~((1 << DS3231_A1F) | (1 << DS3231_A2F) | (1 << DS3231_EN32KHZ));
+    return DS3231_WriteRegister(DS3231_REG_STATUS, &reg);
+#else
     status = DS3231_SetAlarm1IntEn(DS3231_DISABLED);
     if (status != HAL_OK)
         return status;
@@ -45,6 +165,7 @@ HAL_StatusTypeDef DS3231_Init(I2C_HandleTypeDef *i2cHandle) {
     if (status != HAL_OK)
         return status;
     return DS3231_Set32kHzOutput(DS3231_DISABLED);
+#endif
 }
 
 /**
@@ -73,7 +194,7 @@ HAL_StatusTypeDef DS3231_GetBatterySquareWave(DS3231_State *enable) {
     status = DS3231_ReadRegister(DS3231_REG_CONTROL, &control);
     if (status != HAL_OK)
         return status;
-    *enable = (control >> DS3231_BBSQW) & 0x01;
+    *enable = DS3231_Control_BatterySquareWave(control);
     return status;
 }
 
@@ -101,7 +222,7 @@ HAL_StatusTypeDef DS3231_GetOscillatorStoppedFlag(DS3231_State *enable) {
     HAL_StatusTypeDef status;
     uint8_t data;
     status = DS3231_ReadRegister(DS3231_REG_STATUS, &data);
-    *enable = !(data >> DS3231_OSF) & 0x01;
+    *enable = !DS3231_Status_OscillatorStopped(data);
     return status;
 }
 
@@ -130,7 +251,7 @@ HAL_StatusTypeDef DS3231_Get32kHzEnabled(DS3231_State *enable) {
     HAL_StatusTypeDef status;
     uint8_t data;
     status = DS3231_ReadRegister(DS3231_REG_STATUS, &data);
-    *enable = (data >> DS3231_EN32KHZ) & 0x01;
+    *enable = DS3231_Status_32kHzEnabled(data);
     return status;
 }
 
@@ -160,7 +281,7 @@ HAL_StatusTypeDef DS3231_GetInterruptMode(DS3231_InterruptMode *mode) {
     status = DS3231_ReadRegister(DS3231_REG_CONTROL, &control);
     if (status != HAL_OK)
         return status;
-    *mode = (control >> DS3231_INTCN) & 0x01;
+    *mode = DS3231_Control_InterruptMode(control);
     return status;
 }
 
@@ -194,10 +315,28 @@ HAL_StatusTypeDef DS3231_GetRateSelect(DS3231_Rate *rate) {
     status = DS3231_ReadRegister(DS3231_REG_CONTROL, &control);
     if (status != HAL_OK)
         return status;
-    *rate = (control >> DS3231_RS1) & 0x03;
+    *rate = DS3231_Control_Rate(control);
     return status;
 }
 
+#if DS3231_USE_TEMPERATURE
+/**
+ * @brief Get temperature as a fixed point value without floating point arithmetic.
+ * @param[out] *temp_quarters Pass a pointer to int16_t type variable, receives the temperature in 0.25 degree C steps.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_GetTemperatureQuarters(int16_t *temp_quarters) {
+    HAL_StatusTypeDef status;
+    uint8_t buffer[2];
+    status = DS3231_ReadRegisters(DS3231_REG_TEMP_MSB, buffer, 2);
+    if (status != HAL_OK)
+        return status;
+    *temp_quarters = (int16_t) ((int8_t) buffer[0] * 4 + (buffer[1] >> 6));
+    return status;
+}
+#endif
+
+#if DS3231_USE_FLOAT_TEMPERATURE
 /**
  * @brief Get temperature.
  * @param[out] *temp_real Pass a pointer to float type variable.
@@ -205,14 +344,16 @@ HAL_StatusTypeDef DS3231_GetRateSelect(DS3231_Rate *rate) {
  */
 HAL_StatusTypeDef DS3231_GetTemperature(float *temp_real) {
     HAL_StatusTypeDef status;
-    uint8_t buffer[2];
-    status = DS3231_ReadRegisters(DS3231_REG_TEMP_MSB, buffer, 2);
+    int16_t quarters;
+    status = DS3231_GetTemperatureQuarters(&quarters);
     if (status != HAL_OK)
         return status;
-    *temp_real = (buffer[0] + (buffer[1] >> 6) * 0.25f);
+    *temp_real = quarters * 0.25f;
     return status;
 }
+#endif
 
+#if DS3231_USE_ALARMS
 /**
  * @brief Sets configuration of alarm 1 sub-module.
  * @details Set alarm 1 registers like Seconds, Minutes, Hour and Day_Date.\n
@@ -224,15 +365,8 @@ HAL_StatusTypeDef DS3231_GetTemperature(float *temp_real) {
  */
 HAL_StatusTypeDef DS3231_SetAlarm1(D3231_Alarm1 *A1_st) {
     HAL_StatusTypeDef status;
-    uint8_t A1M1 = (A1_st->Mode & 0x01) << 7;   // Seconds bit 7.
-    uint8_t A1M2 = (A1_st->Mode & 0x02) << 6;   // Minutes bit 7.
-    uint8_t A1M3 = (A1_st->Mode & 0x04) << 5;   // Hour bit 7.
-    uint8_t A1M4 = (A1_st->Mode & 0x08) << 4;   // Day/Date bit 7.
-    uint8_t DY_DT = (A1_st->Mode & 0x10) << 2;  // Day/Date bit 6. Date when 0, day of week when 1.
-    uint8_t data[4] = { DS3231_EncodeBCD(A1_st->Seconds) | A1M1,
-                        DS3231_EncodeBCD(A1_st->Minutes) | A1M2,
-                        DS3231_EncodeBCD(A1_st->Hours) | A1M3,
-                        DS3231_EncodeBCD(A1_st->DayDate)| DY_DT | A1M4 };
+    uint8_t data[4];
+    DS3231_EncodeAlarm1(A1_st, data);
     status = DS3231_WriteRegisters(DS3231_REG_A1_SECOND, data, 4);
     if (status != HAL_OK)
         return status;
@@ -254,20 +388,7 @@ HAL_StatusTypeDef DS3231_GetAlarm1(D3231_Alarm1 *A1_st) {
     status = DS3231_ReadRegisters(DS3231_REG_A1_SECOND, data, 4);
     if (status != HAL_OK)
         return status;
-    uint8_t Mode = (data[0] & 0x80) >> 7    // A1M1
-                 | (data[1] & 0x80) >> 6    // A1M2
-                 | (data[2] & 0x80) >> 5    // A1M3
-                 | (data[3] & 0x80) >> 4    // A1M4
-                 | (data[3] & 0x40) >> 2;   // DY_DT
-    A1_st->Mode = Mode;
-    A1_st->Seconds = DS3231_DecodeBCD(data[0] & 0x7F);
-    A1_st->Minutes = DS3231_DecodeBCD(data[1] & 0x7F);
-    A1_st->Hours = DS3231_DecodeBCD(data[2] & 0x3F);
-    uint8_t DayDate = (data[3] & 0x40) >> 6;
-    if (DayDate)
-        A1_st->DayDate = DS3231_DecodeBCD(data[3] & 0x0F);
-    else
-        A1_st->DayDate = DS3231_DecodeBCD(data[3] & 0x3F);
+    DS3231_DecodeAlarm1(data, A1_st);
     return DS3231_GetAlarm1IntEn(&A1_st->IntEn);
 }
 
@@ -301,7 +422,7 @@ HAL_StatusTypeDef DS3231_GetAlarm1IntEn(DS3231_State *enable) {
     status = DS3231_ReadRegister(DS3231_REG_CONTROL, &control);
     if (status != HAL_OK)
         return status;
-    *enable = (control >> DS3231_A1IE) & 0x01;
+    *enable = DS3231_Control_Alarm1IntEn(control);
     return status;
 }
 
@@ -316,7 +437,7 @@ HAL_StatusTypeDef DS3231_GetAlarm1Flag(DS3231_State *enable) {
     HAL_StatusTypeDef status;
     uint8_t data;
     status = DS3231_ReadRegister(DS3231_REG_STATUS, &data);
-    *enable = (data >> DS3231_A1F) & 0x01;
+    *enable = DS3231_Status_Alarm1Flag(data);
     return status;
 }
 
@@ -348,13 +469,8 @@ HAL_StatusTypeDef DS3231_ClearAlarm1Flag(void) {
  */
 HAL_StatusTypeDef DS3231_SetAlarm2(D3231_Alarm2 *A2_st) {
     HAL_StatusTypeDef status;
-    uint8_t A2M2 = (A2_st->Mode & 0x01) << 7; // Minutes bit 7.
-    uint8_t A2M3 = (A2_st->Mode & 0x02) << 6; // Hour bit 7.
-    uint8_t A2M4 = (A2_st->Mode & 0x04) << 5; // Day/Date bit 7.
-    uint8_t DY_DT = (A2_st->Mode & 0x08) << 3; // Day/Date bit 6. Date when 0, day of week when 1.
-    uint8_t data[3] = { DS3231_EncodeBCD(A2_st->Minutes) | A2M2,
-                        DS3231_EncodeBCD(A2_st->Hours) | A2M3,
-                        DS3231_EncodeBCD(A2_st->DayDate) | DY_DT | A2M4 };
+    uint8_t data[3];
+    DS3231_EncodeAlarm2(A2_st, data);
     status = DS3231_WriteRegisters(DS3231_REG_A2_MINUTE, data, 3);
     if (status != HAL_OK)
         return status;
@@ -376,19 +492,7 @@ HAL_StatusTypeDef DS3231_GetAlarm2(D3231_Alarm2 *A2_st) {
     status = DS3231_ReadRegisters(DS3231_REG_A2_MINUTE, data, 3);
     if (status != HAL_OK)
         return status;
-
-    uint8_t Mode = (data[0] & 0x80) >> 7    // A2M2
-                 | (data[1] & 0x80) >> 6    // A2M3
-                 | (data[2] & 0x80) >> 5    // A2M4
-                 | (data[2] & 0x40) >> 3;   // DY_DT
-    A2_st->Mode = Mode;
-    A2_st->Minutes = DS3231_DecodeBCD(data[0] & 0x7F);
-    A2_st->Hours = DS3231_DecodeBCD(data[1] & 0x7F);
-    uint8_t DayDate = (data[2] & 0x40) >> 6;
-    if (DayDate)
-        A2_st->DayDate = DS3231_DecodeBCD(data[2] & 0x0F);
-    else
-        A2_st->DayDate = DS3231_DecodeBCD(data[2] & 0x3F);
+    DS3231_DecodeAlarm2(data, A2_st);
     return DS3231_GetAlarm2IntEn(&A2_st->IntEn);
 }
 
@@ -422,7 +526,7 @@ HAL_StatusTypeDef DS3231_GetAlarm2IntEn(DS3231_State *enable) {
     status = DS3231_ReadRegister(DS3231_REG_CONTROL, &control);
     if (status != HAL_OK)
         return status;
-    *enable = (control >> DS3231_A2IE) & 0x01;
+    *enable = DS3231_Control_Alarm2IntEn(control);
     return status;
 }
 
@@ -437,7 +541,7 @@ HAL_StatusTypeDef DS3231_GetAlarm2Flag(DS3231_State *enable) {
     HAL_StatusTypeDef status;
     uint8_t data;
     status = DS3231_ReadRegister(DS3231_REG_STATUS, &data);
-    *enable = (data >> DS3231_A2F) & 0x01;
+    *enable = DS3231_Status_Alarm2Flag(data);
     return status;
 }
 
@@ -457,44 +561,217 @@ HAL_StatusTypeDef DS3231_ClearAlarm2Flag(void) {
     control &= ~(0x01 << DS3231_A2F);
     return DS3231_WriteRegister(DS3231_REG_STATUS, &control);
 }
+#endif
+
+/**
+ * @brief Reads the whole configuration in one transaction.
+ * @param[out] *cfg Pass a pointer to a #DS3231_Config structure.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_GetConfig(DS3231_Config *cfg) {
+    HAL_StatusTypeDef status;
+    uint8_t regs[DS3231_CONFIG_LEN];
+    uint8_t control, regSTATUS;
+    status = DS3231_ReadRegisters(DS3231_CONFIG_FIRST, regs, DS3231_CONFIG_LEN);
+    if (status != HAL_OK)
+        return status;
+    control = regs[DS3231_REG_CONTROL - DS3231_CONFIG_FIRST];
+    regSTATUS = regs[DS3231_REG_STATUS - DS3231_CONFIG_FIRST];
+    cfg->Oscillator = DS3231_Control_Oscillator(control);
+    cfg->BatterySquareWave = DS3231_Control_BatterySquareWave(control);
+    cfg->InterruptMode = DS3231_Control_InterruptMode(control);
+    cfg->Rate = DS3231_Control_Rate(control);
+    cfg->Output32kHz = DS3231_Status_32kHzEnabled(regSTATUS);
+    cfg->AgingOffset = (int8_t) regs[DS3231_REG_AGING - DS3231_CONFIG_FIRST];
+#if DS3231_USE_ALARMS
+    DS3231_DecodeAlarm1(&regs[DS3231_REG_A1_SECOND - DS3231_CONFIG_FIRST], &cfg->Alarm1);
+    cfg->Alarm1.IntEn = DS3231_Control_Alarm1IntEn(control);
+    DS3231_DecodeAlarm2(&regs[DS3231_REG_A2_MINUTE - DS3231_CONFIG_FIRST], &cfg->Alarm2);
+    cfg->Alarm2.IntEn = DS3231_Control_Alarm2IntEn(control);
+#endif
+    return status;
+}
+
+/**
+ * @brief Reconciles the registers from first up to AGING with cfg, see #DS3231_ApplyConfig.
+ * @param[in] *cfg Desired configuration.
+ * @param[in] first #DS3231_CONFIG_FIRST, or #DS3231_REG_CONTROL to leave the alarm registers out.
+ * @param[in] from First register of the burst read, first or #DS3231_REG_HOUR to also take the hour mode.
+ * @param[out] *changed DS3231_CHANGED_... flags of what was written, may be NULL.
+ * @param[out] *regSTATUS Status register as read before any write, may be NULL.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+static HAL_StatusTypeDef DS3231_Reconcile(const DS3231_Config *cfg, uint8_t first, uint8_t from,
+        uint16_t *changed, uint8_t *regSTATUS) {
+    HAL_StatusTypeDef status;
+    uint8_t snapshot[DS3231_REG_AGING - DS3231_REG_HOUR + 1], desired[DS3231_CONFIG_LEN], diff[DS3231_CONFIG_LEN];
+    uint8_t *current = &snapshot[first - from];
+    const uint8_t len = DS3231_REG_AGING - first + 1;
+    const uint8_t ctrl = DS3231_REG_CONTROL - first, stat = DS3231_REG_STATUS - first;
+    uint8_t i, j, last;
+    uint16_t flags = 0;
+
+    if (changed != NULL)
+        *changed = 0;
+    status = DS3231_ReadRegisters(from, snapshot, DS3231_REG_AGING - from + 1);
+    if (status != HAL_OK)
+        return status;
+    // The alarm hours are encoded in the mode of the time registers.
+    if (from <= DS3231_REG_HOUR)
+        DS3231_hour_mode = DS3231_Hour_Mode(snapshot[DS3231_REG_HOUR - from]);
+    if (regSTATUS != NULL)
+        *regSTATUS = current[stat];
+
+#if DS3231_USE_ALARMS
+    if (first <= DS3231_REG_A1_SECOND) {
+        DS3231_EncodeAlarm1(&cfg->Alarm1, &desired[DS3231_REG_A1_SECOND - first]);
+        DS3231_EncodeAlarm2(&cfg->Alarm2, &desired[DS3231_REG_A2_MINUTE - first]);
+    }
+    desired[ctrl] = ((cfg->Alarm1.IntEn & 0x01) << DS3231_A1IE) | ((cfg->Alarm2.IntEn & 0x01) << DS3231_A2IE);
+#else
+    desired[ctrl] = current[ctrl] & ((1 << DS3231_A1IE) | (1 << DS3231_A2IE));
+#endif
+    desired[ctrl] |= ((!cfg->Oscillator & 0x01) << DS3231_EOSC) | ((cfg->BatterySquareWave & 0x01) << DS3231_BBSQW)
+            | ((cfg->Rate & 0x03) << DS3231_RS1) | ((cfg->InterruptMode & 0x01) << DS3231_INTCN);
+    // Writing 1 leaves the flags untouched, so a flag raised after the read is not lost.
+    desired[stat] = (1 << DS3231_OSF) | (1 << DS3231_A2F) | (1 << DS3231_A1F)
+            | ((cfg->Output32kHz & 0x01) << DS3231_EN32KHZ);
+    desired[DS3231_REG_AGING - first] = (uint8_t) cfg->AgingOffset;
+
+    for (i = 0; i < len; i++)
+        diff[i] = current[i] ^ desired[i];
+    diff[ctrl] &= ~(1 << DS3231_CONV);
+    diff[stat] &= (1 << DS3231_EN32KHZ);
+
+    flags |= DS3231_GetBit(diff[ctrl], DS3231_EOSC) ? DS3231_CHANGED_OSCILLATOR : 0;
+    flags |= DS3231_GetBit(diff[ctrl], DS3231_BBSQW) ? DS3231_CHANGED_BBSQW : 0;
+    flags |= DS3231_GetBit(diff[ctrl], DS3231_INTCN) ? DS3231_CHANGED_INTCN : 0;
+    flags |= (diff[ctrl] & ((1 << DS3231_RS2) | (1 << DS3231_RS1))) ? DS3231_CHANGED_RATE : 0;
+    flags |= DS3231_GetBit(diff[ctrl], DS3231_A1IE) ? DS3231_CHANGED_A1IE : 0;
+    flags |= DS3231_GetBit(diff[ctrl], DS3231_A2IE) ? DS3231_CHANGED_A2IE : 0;
+    flags |= diff[stat] ? DS3231_CHANGED_32KHZ : 0;
+    flags |= diff[DS3231_REG_AGING - first] ? DS3231_CHANGED_AGING : 0;
+#if DS3231_USE_ALARMS
+    if (first <= DS3231_REG_A1_SECOND) {
+        for (i = DS3231_REG_A1_SECOND; i <= DS3231_REG_A1_DATE; i++)
+            flags |= diff[i - first] ? DS3231_CHANGED_ALARM1 : 0;
+        for (i = DS3231_REG_A2_MINUTE; i <= DS3231_REG_A2_DATE; i++)
+            flags |= diff[i - first] ? DS3231_CHANGED_ALARM2 : 0;
+    }
+#endif
+
+    // Alarm registers come before CONTROL, so a new alarm is in place before its interrupt is enabled.
+    for (i = 0; i < len; i = last + 1) {
+        if (!diff[i]) {
+            last = i;
+            continue;
+        }
+        last = i;
+        for (j = i + 1; j < len && j <= last + DS3231_CONFIG_MERGE_GAP + 1; j++)
+            if (diff[j])
+                last = j;
+        status = DS3231_WriteRegisters(first + i, &desired[i], last - i + 1);
+        if (status != HAL_OK)
+            return status;
+    }
+    if (changed != NULL)
+        *changed = flags;
+    return status;
+}
+
+/**
+ * @brief Brings the chip to the configuration in cfg with the fewest transactions.
+ * @details Reads the configuration registers once, builds their desired image and writes only the bytes that
+ * differ. Changed bytes separated by up to #DS3231_CONFIG_MERGE_GAP unchanged ones share one burst. A call that
+ * changes nothing costs one read, a typical mode switch one read and one write.\n
+ * Unlike the setters, INTCN is exactly cfg->InterruptMode whatever else changes.
+ * @param[in] *cfg Pass a pointer to a #DS3231_Config structure with the desired state.
+ * @param[out] *changed Pass a pointer to receive the DS3231_CHANGED_... flags of what was written, may be NULL.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ * @note The alarm flags and OSF are preserved, a running temperature conversion (CONV) is left alone.
+ * Without #DS3231_USE_ALARMS the alarm registers and A1IE/A2IE are not touched.
+ */
+HAL_StatusTypeDef DS3231_ApplyConfig(const DS3231_Config *cfg, uint16_t *changed) {
+    return DS3231_Reconcile(cfg, DS3231_CONFIG_FIRST, DS3231_CONFIG_FIRST, changed, NULL);
+}
+
+/**
+ * @brief Warm-boot replacement for #DS3231_Init that leaves a correctly configured chip alone.
+ * @details Reads the hour register through AGING in one burst, takes the hour mode from it and compares CONTROL,
+ * STATUS and AGING, with check_alarms the alarm registers as well, with cfg. If they match nothing is written, a wake from standby then costs one transaction.
+ * Otherwise only the differing bytes are written as by #DS3231_ApplyConfig.\n
+ * Unlike #DS3231_Init no flag is cleared. OSF, A1F and A2F as found are returned in events, so alarms that fired
+ * while the MCU was down are not lost; clear them once handled.
+ * @param[in] *i2cHandle Pass the pointer of I2C handle.
+ * @param[in] *cfg Pass a pointer to a #DS3231_Config structure with the expected state.
+ * @param[in] check_alarms #DS3231_ENABLED to compare and restore the alarm registers too, ignored without
+ * #DS3231_USE_ALARMS. A1IE and A2IE are always compared.
+ * @param[out] *events Pass a pointer to uint8_t type variable, receives the STATUS bits (1 << #DS3231_OSF),
+ * (1 << #DS3231_A2F) and (1 << #DS3231_A1F) read before any write. May be NULL.
+ * @param[out] *changed Pass a pointer to receive the DS3231_CHANGED_... flags of what was written, may be NULL.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_InitFast(I2C_HandleTypeDef *i2cHandle, const DS3231_Config *cfg, DS3231_State check_alarms,
+        uint8_t *events, uint16_t *changed) {
+    HAL_StatusTypeDef status;
+    uint8_t regSTATUS = 0;
+    DS3231_device = i2cHandle;
+    status = DS3231_Reconcile(cfg, check_alarms ? DS3231_CONFIG_FIRST : DS3231_REG_CONTROL, DS3231_REG_HOUR, changed,
+            &regSTATUS);
+    if (events != NULL)
+        *events = regSTATUS & ((1 << DS3231_OSF) | (1 << DS3231_A2F) | (1 << DS3231_A1F));
+    return status;
+}
+
+/* BCD encodes one register and returns its bit of the error mask, set when value is outside field_min..high. */
+static uint8_t DS3231_EncodeField(uint8_t value, uint8_t reg, uint8_t high, uint8_t *regs) {
+    regs[reg] = (uint8_t) (value + (value / 10) * 6);
+    return (uint8_t) (((value < field_min[reg]) | (value > high)) << reg);
+}
+
+/**
+ * @brief Range checks a date and time and encodes it as registers 0x00..0x06 in one pass.
+ * @details Each field is checked against the field_min and field_max tables, the date against the length of its
+ * month with leap years, and BCD encoded as it is checked. Out of range fields set their bit in the returned
+ * mask instead of returning early, so the cost does not depend on the input.
+ * @param[in] *dt Pass a pointer to #DS3231_DateTime type variable, years 2000 to 2199.
+ * @param[in] mode Hour mode to encode the hour in, #DS3231_24H or #DS3231_12H.
+ * @param[out] *regs Pass a pointer to 7 bytes, valid only when the mask is 0.
+ * @return Mask with bit n set when the field of register n is out of range, 0 when the time is valid.
+ */
+uint8_t DS3231_EncodeDateTime(const DS3231_DateTime *dt, DS3231_HourMode mode, uint8_t *regs) {
+    const uint16_t year = (uint16_t) (dt->Year - 2000U);
+    const uint8_t century = year >= 100;
+    const uint8_t leap = DS3231_IsLeap(dt->Year);
+    const uint8_t date_max = (uint8_t) (days_in_month[dt->Month & 0x0F] + ((dt->Month == 2) & leap));
+    uint8_t errors = (uint8_t) ((year >= 200) << DS3231_REG_YEAR);
+    errors |= DS3231_EncodeField(dt->Second, DS3231_REG_SECOND, field_max[DS3231_REG_SECOND], regs);
+    errors |= DS3231_EncodeField(dt->Minute, DS3231_REG_MINUTE, field_max[DS3231_REG_MINUTE], regs);
+    errors |= DS3231_EncodeField(dt->Hour_24mode, DS3231_REG_HOUR, field_max[DS3231_REG_HOUR], regs);
+    errors |= DS3231_EncodeField(dt->Day, DS3231_REG_DAY, field_max[DS3231_REG_DAY], regs);
+    errors |= DS3231_EncodeField(dt->Date, DS3231_REG_DATE, date_max, regs);
+    errors |= DS3231_EncodeField(dt->Month, DS3231_REG_MONTH, field_max[DS3231_REG_MONTH], regs);
+    errors |= DS3231_EncodeField((uint8_t) (year - 100U * century), DS3231_REG_YEAR, field_max[DS3231_REG_YEAR],
+            regs);
+    regs[DS3231_REG_HOUR] = DS3231_Hour_Encode(dt->Hour_24mode, mode);
+    regs[DS3231_REG_MONTH] |= (uint8_t) (century << DS3231_CENTURY);
+    return errors;
+}
 
 /**
  * @brief Sets the current date and time of RTC and also the enable oscillator (EOSC).
  * @param[in] *dt Pass a pointer to #DS3231_DateTime type variable to set the current date, time and enable oscillator (EOSC) bit.
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  * @note It sets the enable oscillator (EOSC) bit based on the Enable member of #DS3231_DateTime structure variable.\n
- * It only support 24H mode.
+ * Hour_24mode is 0..23, written in the hour mode found by #DS3231_Init or #DS3231_InitFast, or as last read or
+ * written since, see #DS3231_SetHourMode. Years 2100 to 2199
+ * set the century bit. An invalid date or time returns HAL_ERROR without bus traffic, see
+ * #DS3231_EncodeDateTime.
  */
 HAL_StatusTypeDef DS3231_SetDateTime(DS3231_DateTime *dt) {
     HAL_StatusTypeDef status;
     uint8_t buffer[7];
-    if ((dt->Day >= 1) | (dt->Day <= 7))
-        buffer[3] = DS3231_EncodeBCD(dt->Day);
-    else
-        return HAL_ERROR;
-    if ((dt->Date >= 1) | (dt->Date <= 31))
-        buffer[4] = DS3231_EncodeBCD(dt->Date);
-    else
-        return HAL_ERROR;
-    if ((dt->Month >= 1) | (dt->Month <= 12))// Century bit implementation is pending
-        buffer[5] = DS3231_EncodeBCD(dt->Month);
-    else
-        return HAL_ERROR;
-    if ((dt->Year >= 0) | (dt->Year <= 99))
-        buffer[6] = DS3231_EncodeBCD(dt->Year - 2000U);
-    else
-        return HAL_ERROR;
-    if ((dt->Hour_24mode >= 0) | (dt->Hour_24mode <= 23))// Only 24HR mode is supported
-        buffer[2] = DS3231_EncodeBCD(dt->Hour_24mode);
-    else
-        return HAL_ERROR;
-    if ((dt->Minute >= 0) | (dt->Minute <= 59))
-        buffer[1] = DS3231_EncodeBCD(dt->Minute);
-    else
-        return HAL_ERROR;
-    if ((dt->Second >= 0) | (dt->Second <= 59))
-        buffer[0] = DS3231_EncodeBCD(dt->Second);
-    else
+    if (DS3231_EncodeDateTime(dt, DS3231_hour_mode, buffer) != 0)
         return HAL_ERROR;
     status = DS3231_WriteRegisters(DS3231_REG_SECOND, buffer, 7);
     if (status != HAL_OK)
@@ -510,26 +787,97 @@ HAL_StatusTypeDef DS3231_SetDateTime(DS3231_DateTime *dt) {
     return DS3231_WriteRegister(DS3231_REG_CONTROL, &regCONTROL);
 }
 
+static HAL_StatusTypeDef DS3231_ReadDateTime(DS3231_DateTime *dt);
+
+#if DS3231_USE_ASYNC
+/**
+ * @brief Shares time reads between tasks: callers arriving while a read is in flight wait for its result.
+ * @details With a port set, #DS3231_GetDateTime performs at most one read at a time. The first caller reads the
+ * registers, every caller arriving until it completes blocks on the port and receives the same date, time and
+ * status. With fresh_ms above 0 a completed result is also returned to callers within fresh_ms milliseconds of
+ * HAL_GetTick() without a read, so it can be that much behind the device. Writes to the time registers, e.g.
+ * #DS3231_SetDateTime, drop the result.
+
+ * Only #DS3231_GetDateTime is coalesced; other calls still need the bus serialized by the application.
+ * @param[in] *port Pass a pointer to a #DS3231_AsyncPort that outlives its use, NULL turns sharing off.
+ * @param[in] fresh_ms Freshness window in milliseconds, 0 to only share the read in flight.
+ * @return void
+ * @note Call it before the tasks start, or while no task reads the time.
+ */
+void DS3231_SetAsyncPort(const DS3231_AsyncPort *port, uint32_t fresh_ms) {
+    DS3231_flight.Port = port;
+    DS3231_flight.FreshMs = fresh_ms;
+    DS3231_flight.InFlight = 0;
+    DS3231_flight.Fresh = 0;
+}
+
+static HAL_StatusTypeDef DS3231_GetDateTimeShared(const DS3231_AsyncPort *port, DS3231_DateTime *dt) {
+    HAL_StatusTypeDef status;
+    DS3231_DateTime result;
+    uint32_t generation;
+    port->Lock(port->Context);
+    if (DS3231_flight.Fresh && DS3231_flight.Generation == DS3231_time_generation
+            && HAL_GetTick() - DS3231_flight.Tick < DS3231_flight.FreshMs) {
+        *dt = DS3231_flight.Result;
+        port->Unlock(port->Context);
+        return HAL_OK;
+    }
+    if (DS3231_flight.InFlight) {
+        // Join the read in flight.
+        const uint32_t sequence = DS3231_flight.Sequence;
+        while (DS3231_flight.Sequence == sequence)
+            port->Wait(port->Context);
+        *dt = DS3231_flight.Result;
+        status = DS3231_flight.Status;
+        port->Unlock(port->Context);
+        return status;
+    }
+    DS3231_flight.InFlight = 1;
+    generation = DS3231_time_generation;
+    port->Unlock(port->Context);
+
+    status = DS3231_ReadDateTime(&result);
+
+    port->Lock(port->Context);
+    DS3231_flight.Result = result;
+    DS3231_flight.Status = status;
+    DS3231_flight.Generation = generation;
+    DS3231_flight.Tick = HAL_GetTick();
+    DS3231_flight.Fresh = status == HAL_OK && generation == DS3231_time_generation;
+    DS3231_flight.InFlight = 0;
+    DS3231_flight.Sequence++;
+    port->Broadcast(port->Context);
+    port->Unlock(port->Context);
+    *dt = result;
+    return status;
+}
+#endif
+
 /**
  * @brief Reads the current date and time from RTC and also the state of oscillator stop flag (OSF).
  * @param[out] *dt Pass a pointer to #DS3231_DateTime type variable to get the current date, time and oscillator stop flag (OSF).
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  * @note It reads the oscillator stop flag (OSF) bit into the Enable member of #DS3231_DateTime structure variable.\n
- * It only support 24H mode.
+ * Hour_24mode is 0..23 in either hour mode of the device. With #DS3231_USE_ASYNC and a port set, concurrent calls share one read, see
+ * #DS3231_SetAsyncPort.
  */
 HAL_StatusTypeDef DS3231_GetDateTime(DS3231_DateTime *dt) {
+#if DS3231_USE_ASYNC
+    const DS3231_AsyncPort *port = DS3231_flight.Port;
+    if (port != NULL)
+        return DS3231_GetDateTimeShared(port, dt);
+#endif
+    return DS3231_ReadDateTime(dt);
+}
+
+static HAL_StatusTypeDef DS3231_ReadDateTime(DS3231_DateTime *dt) {
     HAL_StatusTypeDef status;
     uint8_t buffer[7];
     status = DS3231_ReadRegisters(DS3231_REG_SECOND, buffer, 7);
     if (status != HAL_OK)
         return status;
-    dt->Second = DS3231_DecodeBCD(buffer[0] & 0x7F);
-    dt->Minute = DS3231_DecodeBCD(buffer[1] & 0x7F);
-    dt->Hour_24mode = DS3231_DecodeBCD(buffer[2] & 0x3F);
-    dt->Day = DS3231_DecodeBCD(buffer[3] & 0x07);
-    dt->Date = DS3231_DecodeBCD(buffer[4] & 0x3F);
-    dt->Month = DS3231_DecodeBCD(buffer[5] & 0x1F);
-    dt->Year = DS3231_DecodeBCD(buffer[6]) + 2000U;
+    DS3231_hour_mode = DS3231_Hour_Mode(buffer[2]);
+    DS3231_DecodeDateTime(buffer, dt);
     uint8_t regSTATUS;
     status = DS3231_ReadRegister(DS3231_REG_STATUS, &regSTATUS);
     if (status != HAL_OK)
@@ -540,33 +888,95 @@ HAL_StatusTypeDef DS3231_GetDateTime(DS3231_DateTime *dt) {
     return status;
 }
 
+/**
+ * @brief Decodes registers 0x00..0x06 as read from the device, the reverse of #DS3231_EncodeDateTime.
+ * @param[in] *regs Pass a pointer to 7 bytes, either hour mode and the century bit included.
+ * @param[out] *dt Pass a pointer to #DS3231_DateTime type variable. Enable is left as it is.
+ */
+void DS3231_DecodeDateTime(const uint8_t *regs, DS3231_DateTime *dt) {
+    dt->Second = DS3231_DecodeBCD(regs[0] & 0x7F);
+    dt->Minute = DS3231_DecodeBCD(regs[1] & 0x7F);
+    dt->Hour_24mode = DS3231_Hour_Decode(regs[2]);
+    dt->Day = DS3231_DecodeBCD(regs[3] & 0x07);
+    dt->Date = DS3231_DecodeBCD(regs[4] & 0x3F);
+    dt->Month = DS3231_DecodeBCD(regs[5] & 0x1F);
+    dt->Year = DS3231_DecodeBCD(regs[6]) + 2000U + (regs[5] >> DS3231_CENTURY) * 100U;
+}
+
+/**
+ * @brief Switches the time and alarm hour registers to 12 hour or 24 hour mode.
+ * @details Converts the hour register and, with #DS3231_USE_ALARMS, both alarm hour registers so the alarms
+ * keep matching. Later writes through the library use the mode, reads decode either mode. The other time
+ * registers are not rewritten, so the running second is not disturbed. Alarm 2 is left alone while it holds
+ * DS3231_Scratchpad.h data.
+ * @param[in] mode #DS3231_24H or #DS3231_12H
+ * @return HAL_StatusTypeDef variable describing if it was successful or not. HAL_BUSY in the last second of an
+ * hour, when the hour may roll over before the write, call it again.
+ */
+HAL_StatusTypeDef DS3231_SetHourMode(DS3231_HourMode mode) {
+    HAL_StatusTypeDef status;
+    uint8_t regs[DS3231_REG_A2_HOUR + 1];
+#if DS3231_USE_ALARMS
+    const uint8_t len = DS3231_REG_A2_HOUR + 1;
+    uint8_t scratchpad;
+#else
+    const uint8_t len = DS3231_REG_HOUR + 1;
+#endif
+    status = DS3231_ReadRegisters(DS3231_REG_SECOND, regs, len);
+    if (status != HAL_OK)
+        return status;
+    if (regs[DS3231_REG_MINUTE] == 0x59 && regs[DS3231_REG_SECOND] == 0x59)
+        return HAL_BUSY;
+    regs[DS3231_REG_HOUR] = DS3231_Hour_Encode(DS3231_Hour_Decode(regs[DS3231_REG_HOUR]), mode);
+    status = DS3231_WriteRegister(DS3231_REG_HOUR, &regs[DS3231_REG_HOUR]);
+#if DS3231_USE_ALARMS
+    if (status != HAL_OK)
+        return status;
+    // Keep the mask bits, A1 hour through A2 hour in one write.
+    regs[DS3231_REG_A1_HOUR] = (uint8_t) ((regs[DS3231_REG_A1_HOUR] & (1 << DS3231_AXMY))
+            | DS3231_Hour_Encode(DS3231_Hour_Decode(regs[DS3231_REG_A1_HOUR]), mode));
+    regs[DS3231_REG_A2_HOUR] = (uint8_t) ((regs[DS3231_REG_A2_HOUR] & (1 << DS3231_AXMY))
+            | DS3231_Hour_Encode(DS3231_Hour_Decode(regs[DS3231_REG_A2_HOUR]), mode));
+    // Alarm 2 minutes 0x60..0x7F mark DS3231_Scratchpad.h data, whose high byte is in the A2 hour register.
+    scratchpad = (regs[DS3231_REG_A2_MINUTE] & 0xE0) == 0x60;
+    status = DS3231_WriteRegisters(DS3231_REG_A1_HOUR, &regs[DS3231_REG_A1_HOUR],
+            (uint8_t) (DS3231_REG_A2_HOUR - DS3231_REG_A1_HOUR + 1 - scratchpad));
+#endif
+    return status;
+}
+
+/**
+ * @brief Reads the hour mode of the time registers.
+ * @param[out] *mode Pass a pointer to #DS3231_HourMode type variable to get #DS3231_24H or #DS3231_12H.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ * @note A board set to 12 hour mode by other firmware keeps it; the library writes in the mode read here.
+ */
+HAL_StatusTypeDef DS3231_GetHourMode(DS3231_HourMode *mode) {
+    HAL_StatusTypeDef status;
+    uint8_t hour;
+    status = DS3231_ReadRegister(DS3231_REG_HOUR, &hour);
+    if (status != HAL_OK)
+        return status;
+    DS3231_hour_mode = DS3231_Hour_Mode(hour);
+    *mode = DS3231_hour_mode;
+    return status;
+}
+
+#if DS3231_USE_CONVERSIONS
 /**
  * @brief Converts the broken down Date Time to unix time
  * @param[in] *dt Pass a pointer to #DS3231_DateTime type variable with current broken down date, time information.
  * @param[out] *unixtime Pass a pointer to uint32_t variable to get unix time, i.e. seconds since epoch.
  * @return void
+ * @note Valid from 1970-01-01 00:00:00 to 2106-02-07 06:28:15, *unixtime is left untouched for years before 1970
+ * or months outside 1 to 12.
  */
 void DS3231_ToUnixTime(DS3231_DateTime *dt, uint32_t *unixtime) {
-    uint16_t days, years;
-    uint8_t months, hours, minutes, seconds;
-    years = dt->Year;
-    months = dt->Month;
-    days = dt->Date;
-    hours = dt->Hour_24mode;
-    minutes = dt->Minute;
-    seconds = dt->Second;
-    if (years >= 2000)
-        years -= 2000;
-    else
+    uint32_t days;
+    if (dt->Year < 1970 || dt->Month < 1 || dt->Month > 12)
         return;
-    days -= 1;
-    for (uint8_t i = 1; i < months; i++)
-        days += days_in_month[i - 1];
-    if (months > 2 && years % 4 == 0)
-        days++;
-    days += (365 * years + (years + 3) / 4);
-    *unixtime = ((days * 24UL + hours) * 60 + minutes)
-            * 60+ seconds + SECONDS_FROM_1970_TO_2000;
+    days = DS3231_DaysBeforeYear(dt->Year) + DS3231_DaysBeforeMonth(dt->Year, dt->Month) + dt->Date - 1;
+    *unixtime = ((days * 24UL + dt->Hour_24mode) * 60 + dt->Minute) * 60 + dt->Second;
 }
 
 /**
@@ -577,14 +987,14 @@ void DS3231_ToUnixTime(DS3231_DateTime *dt, uint32_t *unixtime) {
  */
 void DS3231_ToDateTime(uint32_t *unixtime, DS3231_DateTime *dt) {
     int32_t currYear, daysTillNow, extraTime, extraDays;
-    uint8_t index, day, date, month, flag = 0;
+    uint8_t index, date, month, flag;
     // Calculate total days unix time T
     daysTillNow = (*unixtime / (24 * 60 * 60));
     extraTime = (*unixtime % (24 * 60 * 60));
     currYear = 1970;
     // Calculating current year
     while (1) {
-        if (currYear % 400 == 0 || (currYear % 4 == 0 && currYear % 100 != 0)) {
+        if (DS3231_IsLeap((uint16_t) currYear)) {
             if (daysTillNow < 366) {
                 break;
             }
@@ -601,33 +1011,32 @@ void DS3231_ToDateTime(uint32_t *unixtime, DS3231_DateTime *dt) {
     // will give days till previous day
     // and we have include current day
     extraDays = daysTillNow + 1;
-    if (currYear % 400 == 0 || (currYear % 4 == 0 && currYear % 100 != 0))
-        flag = 1;
+    flag = DS3231_IsLeap((uint16_t) currYear);
     // Calculating MONTH and DATE
     month = 0, index = 0;
     if (flag == 1) {
-        while (1) {
+        while (index < 12) {
             if (index == 1) {
                 if (extraDays - 29 < 0)
                     break;
                 month += 1;
                 extraDays -= 29;
             } else {
-                if (extraDays - days_in_month[index] < 0) {
+                if (extraDays - days_in_month[index + 1] < 0) {
                     break;
                 }
                 month += 1;
-                extraDays -= days_in_month[index];
+                extraDays -= days_in_month[index + 1];
             }
             index += 1;
         }
     } else {
-        while (1) {
-            if (extraDays - days_in_month[index] < 0) {
+        while (index < 12) {
+            if (extraDays - days_in_month[index + 1] < 0) {
                 break;
             }
             month += 1;
-            extraDays -= days_in_month[index];
+            extraDays -= days_in_month[index + 1];
             index += 1;
         }
     }
@@ -639,7 +1048,7 @@ void DS3231_ToDateTime(uint32_t *unixtime, DS3231_DateTime *dt) {
         if (month == 2 && flag == 1)
             date = 29;
         else
-            date = days_in_month[month - 1];
+            date = days_in_month[month];
     }
     // Calculating HH:MM:YYYY
     dt->Date = (uint8_t) date;
@@ -648,14 +1057,11 @@ void DS3231_ToDateTime(uint32_t *unixtime, DS3231_DateTime *dt) {
     dt->Hour_24mode = extraTime / 3600;
     dt->Minute = (extraTime % 3600) / 60;
     dt->Second = (extraTime % 3600) % 60;
-    currYear -= month < 3;
-    day = (currYear + currYear / 4 - currYear / 100 + currYear / 400
-            + dow[month - 1] + date) % 7;
-    if (day == 0)
-        day = 7;
-    dt->Day = day;
+    dt->Day = DS3231_DayOfWeek((uint16_t) currYear, month, date);
 }
+#endif
 
+#if !DS3231_USE_INLINE
 /**
  * @brief Decodes the binary value from BCD format.
  * @param[in] bin binary value.
@@ -673,6 +1079,7 @@ uint8_t DS3231_DecodeBCD(uint8_t bin) {
 uint8_t DS3231_EncodeBCD(uint8_t dec) {
     return (dec % 10 + ((dec / 10) << 4));
 }
+#endif
 
 /**
  * @brief Writes one byte of data to the designated DS3231 register.
@@ -681,8 +1088,7 @@ uint8_t DS3231_EncodeBCD(uint8_t dec) {
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  */
 HAL_StatusTypeDef DS3231_WriteRegister(uint8_t reg, uint8_t *data) {
-    return HAL_I2C_Mem_Write(DS3231_device, DS3231_I2C_ADDR, reg,
-            I2C_MEMADD_SIZE_8BIT, data, 1, DS3231_TIMEOUT);
+    return DS3231_WriteRegisters(reg, data, 1);
 }
 
 /**
@@ -693,8 +1099,21 @@ HAL_StatusTypeDef DS3231_WriteRegister(uint8_t reg, uint8_t *data) {
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  */
 HAL_StatusTypeDef DS3231_WriteRegisters(uint8_t reg, uint8_t *data, uint8_t len) {
-    return HAL_I2C_Mem_Write(DS3231_device, DS3231_I2C_ADDR, reg,
+#if DS3231_USE_CACHE || DS3231_USE_ASYNC
+    if (reg <= DS3231_REG_YEAR || reg + len > DS3231_REG_TEMP_LSB + 1)    /* The pointer wraps after 0x12 */
+        DS3231_time_generation++;
+#endif
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Write(DS3231_device, DS3231_I2C_ADDR, reg,
             I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+#if DS3231_USE_STATS
+    DS3231_stats.Writes++;
+    DS3231_stats.BytesWritten += len;
+    DS3231_stats.Errors += (status != HAL_OK);
+#endif
+    // Any write of the hour register, e.g. by DS3231_ImportImage, sets the mode later writes use.
+    if (status == HAL_OK && reg <= DS3231_REG_HOUR && reg + len > DS3231_REG_HOUR)
+        DS3231_hour_mode = DS3231_Hour_Mode(data[DS3231_REG_HOUR - reg]);
+    return status;
 }
 
 /**
@@ -704,8 +1123,7 @@ HAL_StatusTypeDef DS3231_WriteRegisters(uint8_t reg, uint8_t *data, uint8_t len)
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  */
 HAL_StatusTypeDef DS3231_ReadRegister(uint8_t reg, uint8_t *data) {
-    return HAL_I2C_Mem_Read(DS3231_device, DS3231_I2C_ADDR, reg,
-            I2C_MEMADD_SIZE_8BIT, data, 1, DS3231_TIMEOUT);
+    return DS3231_ReadRegisters(reg, data, 1);
 }
 
 /**
@@ -716,9 +1134,70 @@ HAL_StatusTypeDef DS3231_ReadRegister(uint8_t reg, uint8_t *data) {
  * @return HAL_StatusTypeDef variable describing if it was successful or not.
  */
 HAL_StatusTypeDef DS3231_ReadRegisters(uint8_t reg, uint8_t *data, uint8_t len) {
+#if DS3231_USE_STATS
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Read(DS3231_device, DS3231_I2C_ADDR, reg,
+            I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+    DS3231_stats.Reads++;
+    DS3231_stats.BytesRead += len;
+    DS3231_stats.Errors += (status != HAL_OK);
+    return status;
+#else
     return HAL_I2C_Mem_Read(DS3231_device, DS3231_I2C_ADDR, reg,
             I2C_MEMADD_SIZE_8BIT, data, len, DS3231_TIMEOUT);
+#endif
+}
+
+/**
+ * @brief Reads the CONTROL and STATUS registers in one transaction.
+ * @details Decode the bytes with the DS3231_Control_... and DS3231_Status_... accessors from DS3231_inline.h to
+ * test several bits for the cost of a single read.
+ * @param[out] *regCONTROL Pointer to a variable receiving the CONTROL register.
+ * @param[out] *regSTATUS Pointer to a variable receiving the STATUS register.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_ReadControlStatus(uint8_t *regCONTROL, uint8_t *regSTATUS) {
+    HAL_StatusTypeDef status;
+    uint8_t buffer[2];
+    status = DS3231_ReadRegisters(DS3231_REG_CONTROL, buffer, 2);
+    if (status != HAL_OK)
+        return status;
+    *regCONTROL = buffer[0];
+    *regSTATUS = buffer[1];
+    return status;
+}
+
+#if DS3231_USE_STATS
+/**
+ * @brief Copies the bus transaction counters.
+ * @param[out] *stats Pass a pointer to a #DS3231_Stats structure.
+ * @return void
+ */
+void DS3231_GetStats(DS3231_Stats *stats) {
+    *stats = DS3231_stats;
+}
+
+/**
+ * @brief Clears the bus transaction counters.
+ * @param void
+ * @return void
+ */
+void DS3231_ResetStats(void) {
+    DS3231_Stats zero = { 0 };
+    DS3231_stats = zero;
+}
+#endif
+
+#if DS3231_USE_CACHE || DS3231_USE_ASYNC
+/**
+ * @brief Counter bumped by every write that starts in the time registers, e.g. #DS3231_SetDateTime.
+ * @details Caches of the current time store the value when they fill and drop their entry once it changes.
+ * @param void
+ * @return The current generation.
+ */
+uint32_t DS3231_GetTimeGeneration(void) {
+    return DS3231_time_generation;
 }
+#endif
 
 #ifdef __cplusplus
 }
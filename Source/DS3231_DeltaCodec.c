@@ -0,0 +1,231 @@
+/**
+ *  @brief     Delta-of-delta timestamp compression for RTC stamped logs.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_DeltaCodec.h"
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Code classes in order, the prefix is one '1' per class index followed by a '0', the last class has no '0'. */
+static const uint8_t delta_payload_bits[6] = { 0, 7, 9, 12, 32, 64 };
+
+/*------------------------------------ BIT STREAM -----------------------------------------------*/
+static void DS3231_DeltaPutBits(uint8_t *block, uint32_t pos, uint64_t value, uint8_t bits) {
+    while (bits) {
+        uint8_t room = 8 - (pos & 7);
+        uint8_t take = bits < room ? bits : room;
+        uint8_t chunk = (uint8_t) ((value >> (bits - take)) & ((1U << take) - 1));
+        block[pos >> 3] |= (uint8_t) (chunk << (room - take));
+        pos += take;
+        bits -= take;
+    }
+}
+
+static uint64_t DS3231_DeltaGetBits(const uint8_t *block, uint32_t pos, uint8_t bits) {
+    uint64_t value = 0;
+    while (bits) {
+        uint8_t room = 8 - (pos & 7);
+        uint8_t take = bits < room ? bits : room;
+        value = value << take | ((block[pos >> 3] >> (room - take)) & ((1U << take) - 1));
+        pos += take;
+        bits -= take;
+    }
+    return value;
+}
+
+/*------------------------------------ HELPERS --------------------------------------------------*/
+static uint64_t DS3231_DeltaQuantize(DS3231_DeltaTime *time, uint8_t fraction_bits) {
+    return (uint64_t) time->Seconds << fraction_bits | (uint32_t) time->Fraction >> (16 - fraction_bits);
+}
+
+static void DS3231_DeltaExpand(uint64_t q, uint8_t fraction_bits, DS3231_DeltaTime *time) {
+    time->Seconds = (uint32_t) (q >> fraction_bits);
+    time->Fraction = (uint16_t) ((q & ((1UL << fraction_bits) - 1)) << (16 - fraction_bits));
+}
+
+static uint16_t DS3231_DeltaGet16(const uint8_t *p) {
+    return (uint16_t) (p[0] | p[1] << 8);
+}
+
+static void DS3231_DeltaPut16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t) v;
+    p[1] = (uint8_t) (v >> 8);
+}
+
+/*------------------------------------ FUNCTION DEFINATIONS -------------------------------------*/
+/**
+ * @brief Starts a new block, clearing it.
+ * @param[out] *enc Pass a pointer to #DS3231_DeltaEncoder type variable.
+ * @param[in] *block Pass a pointer to the block buffer.
+ * @param[in] size Block size in bytes, larger than #DS3231_DELTA_HEADER_SIZE.
+ * @param[in] fraction_bits Sub-second bits to keep, 0 for whole seconds up to #DS3231_DELTA_MAX_FRACTION.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_DeltaEncoder_Begin(DS3231_DeltaEncoder *enc, uint8_t *block, uint16_t size,
+        uint8_t fraction_bits) {
+    if (size <= DS3231_DELTA_HEADER_SIZE || fraction_bits > DS3231_DELTA_MAX_FRACTION)
+        return HAL_ERROR;
+    memset(block, 0, size);
+    block[0] = DS3231_DELTA_VERSION;
+    block[1] = fraction_bits;
+    enc->Block = block;
+    enc->Size = size;
+    enc->Count = 0;
+    enc->BitPos = DS3231_DELTA_HEADER_SIZE * 8UL;
+    enc->FractionBits = fraction_bits;
+    enc->Prev = 0;
+    enc->PrevDelta = 0;
+    return HAL_OK;
+}
+
+/**
+ * @brief Appends one timestamp to the block.
+ * @param[in,out] *enc Pass a pointer to #DS3231_DeltaEncoder type variable.
+ * @param[in] *time Pass a pointer to #DS3231_DeltaTime type variable.
+ * @return 1 when stored, 0 when the block is full. Store the block, call #DS3231_DeltaEncoder_Begin and append
+ * the same timestamp again, it becomes the anchor of the new block.
+ */
+uint8_t DS3231_DeltaEncoder_Append(DS3231_DeltaEncoder *enc, DS3231_DeltaTime *time) {
+    uint64_t q = DS3231_DeltaQuantize(time, enc->FractionBits);
+    int64_t delta, dod;
+    uint64_t zigzag;
+    uint8_t cls;
+
+    if (enc->Count == 0xFFFF)
+        return 0;
+    if (enc->Count == 0) {
+        DS3231_DeltaPut16(&enc->Block[4], (uint16_t) time->Seconds);
+        DS3231_DeltaPut16(&enc->Block[6], (uint16_t) (time->Seconds >> 16));
+        DS3231_DeltaPut16(&enc->Block[8], time->Fraction & (uint16_t) ~(0xFFFFU >> enc->FractionBits));
+    } else {
+        delta = (int64_t) (q - enc->Prev);
+        dod = delta - enc->PrevDelta;
+        zigzag = (uint64_t) dod << 1 ^ (uint64_t) (dod >> 63);
+        cls = zigzag == 0 ? 0 : zigzag < 1U << 7 ? 1 : zigzag < 1U << 9 ? 2 : zigzag < 1U << 12 ? 3
+                : zigzag <= 0xFFFFFFFFUL ? 4 : 5;
+        if (enc->BitPos + cls + (cls < 5) + delta_payload_bits[cls] > enc->Size * 8UL)
+            return 0;
+        /* cls ones and a terminating zero, the last class needs no terminator */
+        DS3231_DeltaPutBits(enc->Block, enc->BitPos, ((1U << cls) - 1) << (cls < 5), cls + (cls < 5));
+        enc->BitPos += cls + (cls < 5);
+        DS3231_DeltaPutBits(enc->Block, enc->BitPos, zigzag, delta_payload_bits[cls]);
+        enc->BitPos += delta_payload_bits[cls];
+        enc->PrevDelta = delta;
+    }
+    enc->Prev = q;
+    enc->Count++;
+    DS3231_DeltaPut16(&enc->Block[2], enc->Count);
+    return 1;
+}
+
+/**
+ * @brief Bytes of the block in use, the rest is zero.
+ * @param[in] *enc Pass a pointer to #DS3231_DeltaEncoder type variable.
+ * @return Used bytes including the header.
+ */
+uint16_t DS3231_DeltaEncoder_Used(DS3231_DeltaEncoder *enc) {
+    return (uint16_t) ((enc->BitPos + 7) / 8);
+}
+
+/**
+ * @brief Starts decoding a block.
+ * @param[out] *dec Pass a pointer to #DS3231_DeltaDecoder type variable.
+ * @param[in] *block Pass a pointer to the block.
+ * @param[in] size Block size in bytes.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR for an unknown header.
+ */
+HAL_StatusTypeDef DS3231_DeltaDecoder_Begin(DS3231_DeltaDecoder *dec, const uint8_t *block, uint16_t size) {
+    if (size <= DS3231_DELTA_HEADER_SIZE || block[0] != DS3231_DELTA_VERSION
+            || block[1] > DS3231_DELTA_MAX_FRACTION)
+        return HAL_ERROR;
+    dec->Block = block;
+    dec->Size = size;
+    dec->Count = DS3231_DeltaGet16(&block[2]);
+    dec->Index = 0;
+    dec->BitPos = DS3231_DELTA_HEADER_SIZE * 8UL;
+    dec->FractionBits = block[1];
+    dec->Prev = 0;
+    dec->PrevDelta = 0;
+    return HAL_OK;
+}
+
+/**
+ * @brief Returns the next timestamp of the block.
+ * @param[in,out] *dec Pass a pointer to #DS3231_DeltaDecoder type variable.
+ * @param[out] *time Pass a pointer to #DS3231_DeltaTime type variable.
+ * @return 1 when a timestamp was returned, 0 at the end of the block or on a truncated code.
+ */
+uint8_t DS3231_DeltaDecoder_Next(DS3231_DeltaDecoder *dec, DS3231_DeltaTime *time) {
+    const uint32_t end = dec->Size * 8UL;
+    uint64_t zigzag;
+    uint8_t cls = 0;
+
+    if (dec->Index >= dec->Count)
+        return 0;
+    if (dec->Index == 0) {
+        DS3231_DeltaBlockAnchor(dec->Block, time);
+        dec->Prev = DS3231_DeltaQuantize(time, dec->FractionBits);
+    } else {
+        while (cls < 5) {
+            if (dec->BitPos >= end)
+                return 0;
+            if (!DS3231_DeltaGetBits(dec->Block, dec->BitPos++, 1))
+                break;
+            cls++;
+        }
+        if (dec->BitPos + delta_payload_bits[cls] > end)
+            return 0;
+        zigzag = DS3231_DeltaGetBits(dec->Block, dec->BitPos, delta_payload_bits[cls]);
+        dec->BitPos += delta_payload_bits[cls];
+        dec->PrevDelta += (int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1);
+        dec->Prev += (uint64_t) dec->PrevDelta;
+        DS3231_DeltaExpand(dec->Prev, dec->FractionBits, time);
+    }
+    dec->Index++;
+    return 1;
+}
+
+/**
+ * @brief Reads the anchor, the first timestamp, of a block.
+ * @param[in] *block Pass a pointer to the block.
+ * @param[out] *time Pass a pointer to #DS3231_DeltaTime type variable.
+ * @return void
+ */
+void DS3231_DeltaBlockAnchor(const uint8_t *block, DS3231_DeltaTime *time) {
+    time->Seconds = DS3231_DeltaGet16(&block[4]) | (uint32_t) DS3231_DeltaGet16(&block[6]) << 16;
+    time->Fraction = DS3231_DeltaGet16(&block[8]);
+}
+
+/**
+ * @brief Finds the block holding a timestamp with a binary search over the block anchors.
+ * @param[in] *blocks Pass a pointer to consecutive blocks in time order.
+ * @param[in] count Number of blocks.
+ * @param[in] size Block size in bytes.
+ * @param[in] *time Pass a pointer to #DS3231_DeltaTime type variable.
+ * @return Index of the last block whose anchor is not later than time, 0 when time precedes every block.
+ */
+size_t DS3231_DeltaFindBlock(const uint8_t *blocks, size_t count, uint16_t size, DS3231_DeltaTime *time) {
+    size_t lo = 0, hi = count;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        DS3231_DeltaTime anchor;
+        DS3231_DeltaBlockAnchor(blocks + mid * size, &anchor);
+        if (anchor.Seconds < time->Seconds
+                || (anchor.Seconds == time->Seconds && anchor.Fraction <= time->Fraction))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,104 @@
+/**
+ *  @brief     Conversions between unix time and the NTP, GPS, TAI and Julian day time scales.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Epoch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Converts unix times to NTP timestamps.
+ * @param[in] *unixtime Pass a pointer to count unix times in whole seconds.
+ * @param[out] *ntp Pass a pointer to count uint64_t, NTP timestamps in 32.32 fixed point.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_ToNTPBatch(const uint32_t *unixtime, uint64_t *ntp, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        ntp[i] = DS3231_Epoch_UnixToNTP((uint64_t) unixtime[i] << 32);
+}
+
+/**
+ * @brief Converts NTP timestamps of era 0 or 1 to unix times, the fraction of the second is dropped.
+ * @param[in] *ntp Pass a pointer to count NTP timestamps in 32.32 fixed point.
+ * @param[out] *unixtime Pass a pointer to count uint32_t.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_FromNTPBatch(const uint64_t *ntp, uint32_t *unixtime, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        unixtime[i] = (uint32_t) (DS3231_Epoch_NTPToUnix(ntp[i]) >> 32);
+}
+
+/**
+ * @brief Converts unix times to TAI seconds since 1970-01-01 TAI.
+ * @param[in] *unixtime Pass a pointer to count unix times in whole seconds.
+ * @param[in] tai_utc TAI - UTC in seconds, #DS3231_EPOCH_TAI_UTC.
+ * @param[out] *tai Pass a pointer to count uint64_t, TAI in 32.32 fixed point.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_ToTAIBatch(const uint32_t *unixtime, uint8_t tai_utc, uint64_t *tai, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        tai[i] = DS3231_Epoch_UnixToTAI((uint64_t) unixtime[i] << 32, tai_utc);
+}
+
+/**
+ * @brief Converts unix times to GPS week and time of week.
+ * @param[in] *unixtime Pass a pointer to count unix times from 1980-01-06 on.
+ * @param[in] tai_utc TAI - UTC in seconds, #DS3231_EPOCH_TAI_UTC.
+ * @param[out] *gps Pass a pointer to count #DS3231_GpsTime.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_ToGPSBatch(const uint32_t *unixtime, uint8_t tai_utc, DS3231_GpsTime *gps, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        gps[i] = DS3231_Epoch_UnixToGPS(unixtime[i], tai_utc);
+}
+
+/**
+ * @brief Converts GPS week and time of week to unix times.
+ * @param[in] *gps Pass a pointer to count #DS3231_GpsTime.
+ * @param[in] tai_utc TAI - UTC in seconds, #DS3231_EPOCH_TAI_UTC.
+ * @param[out] *unixtime Pass a pointer to count uint32_t.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_FromGPSBatch(const DS3231_GpsTime *gps, uint8_t tai_utc, uint32_t *unixtime, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        unixtime[i] = DS3231_Epoch_GPSToUnix(gps[i], tai_utc);
+}
+
+/**
+ * @brief Converts unix times to Modified Julian Dates and seconds of the day.
+ * @param[in] *unixtime Pass a pointer to count unix times.
+ * @param[out] *mjd Pass a pointer to count uint32_t.
+ * @param[out] *sod Pass a pointer to count uint32_t, 0..86399.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_ToMJDBatch(const uint32_t *unixtime, uint32_t *mjd, uint32_t *sod, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        mjd[i] = DS3231_Epoch_UnixToMJD(unixtime[i], &sod[i]);
+}
+
+/**
+ * @brief Converts unix times to Julian Days.
+ * @param[in] *unixtime Pass a pointer to count unix times.
+ * @param[out] *jd Pass a pointer to count uint64_t, Julian Days in 32.32 fixed point.
+ * @param[in] count Number of times.
+ * @return void
+ */
+void DS3231_Epoch_ToJDBatch(const uint32_t *unixtime, uint64_t *jd, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+        jd[i] = DS3231_Epoch_UnixToJD(unixtime[i]);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+/**
+ *  @brief     FatFs timestamp provider for the DS3231 library.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_FatTime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if DS3231_USE_CACHE
+typedef struct DS3231_FatTimeCache {
+    uint32_t FatTime;
+    uint32_t ReadTick;          /* HAL tick taken before the last register read */
+    uint32_t ValidUntil;        /* FatTime is served for ticks before this one */
+    uint32_t Generation;        /* #DS3231_GetTimeGeneration at the last read */
+    uint8_t Second;             /* Raw seconds register of the last read */
+    uint8_t Valid;
+} DS3231_FatTimeCache;
+
+static DS3231_FatTimeCache DS3231_fattime_cache;
+#endif
+
+/**
+ * @brief Reads the current time as a FAT date/time word.
+ * @details With #DS3231_USE_CACHE the seconds register of each read is compared with the previous read. When it
+ * changed, the current second started after the previous read, so it cannot end before 1000 ms after that read's
+ * tick. Calls up to then, less #DS3231_FATTIME_GUARD_MS, are answered from the cache without bus traffic. A
+ * caller polling every few milliseconds therefore costs a handful of reads around each second boundary instead of
+ * one read per call. Any write to the time registers drops the cache.
+ * @param[out] *fattime Pass a pointer to uint32_t type variable.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_GetFatTime(uint32_t *fattime) {
+    HAL_StatusTypeDef status;
+    DS3231_RawTime raw;
+#if DS3231_USE_CACHE
+    DS3231_FatTimeCache *cache = &DS3231_fattime_cache;
+    uint32_t tick = HAL_GetTick();
+    uint32_t generation = DS3231_GetTimeGeneration();
+    uint8_t coherent = cache->Valid && cache->Generation == generation;
+    if (coherent && (int32_t) (cache->ValidUntil - tick) > 0) {
+        *fattime = cache->FatTime;
+        return HAL_OK;
+    }
+#endif
+    status = DS3231_GetRawTime(&raw);
+    if (status != HAL_OK)
+        return status;
+    *fattime = DS3231_FatTime_FromRaw(&raw);
+#if DS3231_USE_CACHE
+    if (coherent && raw.Regs[0] != cache->Second)
+        cache->ValidUntil = cache->ReadTick + 1000U - DS3231_FATTIME_GUARD_MS;
+    else
+        cache->ValidUntil = tick;
+    cache->FatTime = *fattime;
+    cache->ReadTick = tick;
+    cache->Generation = generation;
+    cache->Second = raw.Regs[0];
+    cache->Valid = 1;
+#endif
+    return status;
+}
+
+#if DS3231_USE_CACHE
+/**
+ * @brief Drops the cached FAT time, e.g. after the device was reset or swapped.
+ * @param void
+ * @return void
+ * @note Writes through this library already invalidate the cache.
+ */
+void DS3231_FatTime_Invalidate(void) {
+    DS3231_fattime_cache.Valid = 0;
+}
+#endif
+
+#if DS3231_FATTIME_PROVIDER
+/**
+ * @brief FatFs real time clock callback.
+ * @param void
+ * @return FAT date/time word, #DS3231_FATTIME_FALLBACK when the device cannot be read.
+ */
+uint32_t get_fattime(void) {
+    uint32_t fattime;
+    if (DS3231_GetFatTime(&fattime) != HAL_OK)
+        return DS3231_FATTIME_FALLBACK;
+    return fattime;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,144 @@
+/**
+ *  @brief     Background health monitor for the DS3231.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Health.h"
+#include "DS3231_RawTime.h"
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Time writes through the library bump the generation, it only exists with a cache or the async port. */
+#if DS3231_USE_CACHE || DS3231_USE_ASYNC
+#define DS3231_HEALTH_GENERATION()  DS3231_GetTimeGeneration()
+#else
+#define DS3231_HEALTH_GENERATION()  0UL
+#endif
+
+/**
+ * @brief Initializes a health monitor, the first sample runs at the fast period.
+ * @param[out] *health Pass a pointer to a #DS3231_Health structure.
+ * @param[in] slow_ms Sampling period while healthy, e.g. 60000.
+ * @param[in] fast_ms Sampling period after an anomaly, e.g. 250. At most slow_ms.
+ * @param[in] temp_low Lowest healthy temperature in 0.25 degree C steps.
+ * @param[in] temp_high Highest healthy temperature in 0.25 degree C steps.
+ * @return void
+ */
+void DS3231_Health_Init(DS3231_Health *health, uint32_t slow_ms, uint32_t fast_ms, int16_t temp_low,
+        int16_t temp_high) {
+    health->Word = 0;
+    health->SlowMs = slow_ms;
+    health->FastMs = fast_ms ? fast_ms : 1;
+    health->PeriodMs = health->FastMs;
+    health->RefTick = 0;
+    health->RefTime = 0;
+    health->BusySince = 0;
+    health->Generation = DS3231_HEALTH_GENERATION();
+    health->TempLow = temp_low;
+    health->TempHigh = temp_high;
+    health->HasRef = 0;
+    health->Busy = 0;
+}
+
+#if DS3231_USE_CONVERSIONS
+/* Checks the time against HAL_GetTick() since the seconds last changed, returns STALL or TIME_JUMP flags. */
+static uint8_t DS3231_Health_CheckTime(DS3231_Health *health, const uint8_t *time, uint32_t now) {
+    DS3231_DateTime dt;
+    uint32_t unixtime = 0, elapsed, expected;
+    int32_t advanced;
+    uint32_t generation = DS3231_HEALTH_GENERATION();
+    DS3231_RawTime_ToDateTime(DS3231_RAWTIME(time), &dt);
+    DS3231_ToUnixTime(&dt, &unixtime);
+    if (!health->HasRef || generation != health->Generation) {
+        health->Generation = generation;
+        health->HasRef = 1;
+        health->RefTick = now;
+        health->RefTime = unixtime;
+        return 0;
+    }
+    elapsed = now - health->RefTick;
+    advanced = (int32_t) (unixtime - health->RefTime);
+    if (advanced == 0)
+        return elapsed >= DS3231_HEALTH_STALL_MS ? DS3231_HEALTH_STALL : 0;
+    health->RefTick = now;
+    health->RefTime = unixtime;
+    // Whole seconds against milliseconds: up to a second apart, plus 1/64 for the MCU clock and latency.
+    expected = (uint32_t) (advanced < 0 ? -advanced : advanced) * 1000U;
+    if (advanced < 0 || (expected > elapsed ? expected - elapsed : elapsed - expected) > 1100U + elapsed / 64)
+        return DS3231_HEALTH_TIME_JUMP;
+    return 0;
+}
+#endif
+
+/**
+ * @brief Takes one sample, updates the health word and returns when to sample next.
+ * @details Run it from the monitor task: for (;;) { DS3231_Health_Sample(&health, &wait); osDelay(wait); }. A
+ * fault that appears, or any time jump, counts as an anomaly and sets the fast period. Each sample without one
+ * doubles the period up to the slow period, which also clears #DS3231_HEALTH_TIME_JUMP. Faults that persist,
+ * e.g. OSF until the time is set, stay in the word without keeping the period fast.
+ * @param[in,out] *health Pass a pointer to a #DS3231_Health structure.
+ * @param[out] *next_ms Pass a pointer to a uint32_t variable to get the delay until the next sample.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_Health_Sample(DS3231_Health *health, uint32_t *next_ms) {
+    uint8_t regs[DS3231_HEALTH_SAMPLE_LEN];
+    const uint32_t previous = health->Word;
+    const uint32_t now = HAL_GetTick();
+    uint8_t flags = DS3231_HEALTH_FLAGS(previous) & (DS3231_HEALTH_FAULTS | DS3231_HEALTH_VALID);
+    uint8_t anomalies = DS3231_HEALTH_ANOMALIES(previous), jump = 0, confirm = 0;
+    int16_t temperature = DS3231_HEALTH_TEMPERATURE_Q(previous);
+    HAL_StatusTypeDef status = DS3231_ReadRegisters(DS3231_REG_STATUS, regs, DS3231_HEALTH_SAMPLE_LEN);
+
+    if (status != HAL_OK) {
+        flags |= DS3231_HEALTH_BUS_ERROR;
+    } else {
+        const uint8_t regSTATUS = regs[0];
+        flags = (uint8_t) ((flags & DS3231_HEALTH_TIME_JUMP) | DS3231_HEALTH_VALID);
+        if (regSTATUS & (1 << DS3231_OSF))
+            flags |= DS3231_HEALTH_OSF;
+        if (!(regSTATUS & (1 << DS3231_BSY))) {
+            health->Busy = 0;
+        } else if (!health->Busy) {
+            health->Busy = 1;
+            health->BusySince = now;
+            confirm = 1;    // Normal during a conversion, sample fast to tell a stuck BSY apart.
+        } else if (now - health->BusySince >= DS3231_HEALTH_BUSY_MS) {
+            flags |= DS3231_HEALTH_BUSY_STUCK;
+        }
+        temperature = (int16_t) ((int8_t) regs[2] * 4 + (regs[3] >> 6));
+        if (temperature < health->TempLow || temperature > health->TempHigh)
+            flags |= DS3231_HEALTH_TEMPERATURE;
+#if DS3231_USE_CONVERSIONS
+        jump = DS3231_Health_CheckTime(health, &regs[4], now);
+        flags |= jump;
+        jump &= DS3231_HEALTH_TIME_JUMP;
+#endif
+    }
+
+    // New faults and every jump are anomalies, faults that persist are not.
+    if (jump || (flags & ~DS3231_HEALTH_FLAGS(previous) & DS3231_HEALTH_FAULTS)) {
+        if (anomalies < 0xFF)
+            anomalies++;
+        health->PeriodMs = health->FastMs;
+    } else if (confirm || health->Busy) {
+        health->PeriodMs = health->FastMs;
+    } else if (health->PeriodMs < health->SlowMs) {
+        health->PeriodMs = health->PeriodMs > health->SlowMs / 2 ? health->SlowMs : health->PeriodMs * 2;
+    }
+    if (health->PeriodMs >= health->SlowMs)
+        flags &= ~DS3231_HEALTH_TIME_JUMP;
+    else
+        flags |= DS3231_HEALTH_FAST;
+    health->Word = (uint32_t) (uint16_t) temperature << 16 | (uint32_t) anomalies << 8 | flags;
+    *next_ms = health->PeriodMs;
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
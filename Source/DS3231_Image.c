@@ -0,0 +1,203 @@
+/**
+ *  @brief     Register image export and import for provisioning many DS3231 boards.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Image.h"
+#include "DS3231_RawTime.h"
+#include "DS3231_calendar.h"
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Region each register of the image belongs to. */
+static const uint8_t DS3231_image_region[DS3231_IMAGE_REGS] = {
+    DS3231_IMAGE_TIME, DS3231_IMAGE_TIME, DS3231_IMAGE_TIME, DS3231_IMAGE_TIME,
+    DS3231_IMAGE_TIME, DS3231_IMAGE_TIME, DS3231_IMAGE_TIME,
+    DS3231_IMAGE_ALARM1, DS3231_IMAGE_ALARM1, DS3231_IMAGE_ALARM1, DS3231_IMAGE_ALARM1,
+    DS3231_IMAGE_ALARM2, DS3231_IMAGE_ALARM2, DS3231_IMAGE_ALARM2,
+    DS3231_IMAGE_CONTROL, DS3231_IMAGE_STATUS, DS3231_IMAGE_AGING
+};
+
+/**
+ * @brief CRC-8 with polynomial x^8 + x^2 + x + 1, as used for the image trailer.
+ * @param[in] *data Bytes to check.
+ * @param[in] len Number of bytes.
+ * @return CRC-8 of the bytes, started from 0.
+ */
+uint8_t DS3231_Image_CRC(const uint8_t *data, uint8_t len) {
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++)
+            crc = (uint8_t) ((crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+    return crc;
+}
+
+/**
+ * @brief Builds an image from a register buffer.
+ * @details Registers outside regions are stored as 0. CONV is dropped from CONTROL and only EN32kHz is kept of
+ * STATUS, so importing never starts a conversion and clears the alarm flags.
+ * @param[in] *regs Pass a pointer to #DS3231_IMAGE_REGS bytes, registers 0x00..0x10 as read.
+ * @param[in] regions DS3231_IMAGE_... region mask.
+ * @param[out] *image Pass a pointer to a uint8_t buffer of #DS3231_IMAGE_SIZE bytes.
+ * @return void
+ */
+void DS3231_Image_Build(const uint8_t *regs, uint8_t regions, uint8_t *image) {
+    uint8_t *out = &image[DS3231_IMAGE_HEADER];
+    image[0] = 'D';
+    image[1] = '3';
+    image[2] = DS3231_IMAGE_VERSION;
+    image[3] = regions & DS3231_IMAGE_ALL;
+    for (uint8_t reg = 0; reg < DS3231_IMAGE_REGS; reg++)
+        out[reg] = (DS3231_image_region[reg] & regions) ? regs[reg] : 0;
+    out[DS3231_REG_CONTROL] &= ~(1 << DS3231_CONV);
+    out[DS3231_REG_STATUS] &= (1 << DS3231_EN32KHZ);
+    image[DS3231_IMAGE_SIZE - 1] = DS3231_Image_CRC(image, DS3231_IMAGE_SIZE - 1);
+}
+
+/**
+ * @brief Checks the header and the CRC of an image.
+ * @param[in] *image Pass a pointer to #DS3231_IMAGE_SIZE bytes.
+ * @return HAL_OK for a valid image of this version, HAL_ERROR otherwise.
+ */
+HAL_StatusTypeDef DS3231_Image_Check(const uint8_t *image) {
+    if (image[0] != 'D' || image[1] != '3' || image[2] != DS3231_IMAGE_VERSION)
+        return HAL_ERROR;
+    if (image[3] == 0 || (image[3] & ~DS3231_IMAGE_ALL))
+        return HAL_ERROR;
+    if (DS3231_Image_CRC(image, DS3231_IMAGE_SIZE - 1) != image[DS3231_IMAGE_SIZE - 1])
+        return HAL_ERROR;
+    return HAL_OK;
+}
+
+/**
+ * @brief Advances the time registers of a register buffer by whole seconds.
+ * @details Counts in days since 1970 and 64-bit seconds, so the whole 2000..2199 range of the registers is
+ * reached, past the end of 32-bit unix time in 2106.
+ * @param[in,out] *regs Pass a pointer to registers 0x00..0x06, the hour in either mode, which is kept.
+ * @param[in] elapsed Seconds to add.
+ * @return HAL_OK, HAL_ERROR if the result leaves 2000..2199 or elapsed is not 0 without #DS3231_USE_CONVERSIONS.
+ */
+HAL_StatusTypeDef DS3231_Image_Advance(uint8_t *regs, uint32_t elapsed) {
+    if (elapsed == 0)
+        return HAL_OK;
+#if DS3231_USE_CONVERSIONS
+    DS3231_DateTime dt;
+    uint8_t time[7];
+    uint64_t seconds;
+    uint32_t days;
+    uint16_t year;
+    uint8_t month;
+    DS3231_RawTime_ToDateTime(DS3231_RAWTIME(regs), &dt);
+    if (dt.Month < 1 || dt.Month > 12)
+        return HAL_ERROR;
+    days = DS3231_DaysBeforeYear(dt.Year) + DS3231_DaysBeforeMonth(dt.Year, dt.Month) + dt.Date - 1U;
+    seconds = (uint64_t) days * 86400U + dt.Hour_24mode * 3600UL + dt.Minute * 60U + dt.Second + elapsed;
+    days = (uint32_t) (seconds / 86400U);
+    if (days >= DS3231_DaysBeforeYear(2200))
+        return HAL_ERROR;
+    // The estimate is at most one year late.
+    year = (uint16_t) (1970U + days / 366U);
+    while (DS3231_DaysBeforeYear((uint16_t) (year + 1)) <= days)
+        year++;
+    days -= DS3231_DaysBeforeYear(year);
+    for (month = 12; days < DS3231_DaysBeforeMonth(year, month); month--)
+        ;
+    dt.Date = (uint8_t) (days - DS3231_DaysBeforeMonth(year, month) + 1U);
+    dt.Month = month;
+    dt.Year = year;
+    dt.Day = DS3231_DayOfWeek(year, month, dt.Date);
+    dt.Hour_24mode = (uint8_t) (seconds % 86400U / 3600U);
+    dt.Minute = (uint8_t) (seconds % 3600U / 60U);
+    dt.Second = (uint8_t) (seconds % 60U);
+    if (DS3231_EncodeDateTime(&dt, DS3231_Hour_Mode(regs[DS3231_REG_HOUR]), time) != 0)
+        return HAL_ERROR;
+    memcpy(regs, time, sizeof(time));
+    return HAL_OK;
+#else
+    (void) regs;
+    return HAL_ERROR;
+#endif
+}
+
+/**
+ * @brief Number of burst writes #DS3231_ImportImage needs for a region mask.
+ * @param[in] regions DS3231_IMAGE_... region mask.
+ * @return Number of contiguous register runs, 1 for #DS3231_IMAGE_ALL.
+ */
+uint8_t DS3231_Image_Bursts(uint8_t regions) {
+    uint8_t bursts = 0, inside = 0;
+    for (uint8_t reg = 0; reg < DS3231_IMAGE_REGS; reg++) {
+        uint8_t carried = (DS3231_image_region[reg] & regions) != 0;
+        bursts += carried & !inside;
+        inside = carried;
+    }
+    return bursts;
+}
+
+/**
+ * @brief Reads registers 0x00..0x10 in one transaction and stores the selected regions as an image.
+ * @param[out] *image Pass a pointer to a uint8_t buffer of #DS3231_IMAGE_SIZE bytes.
+ * @param[in] regions DS3231_IMAGE_... region mask, #DS3231_IMAGE_ALL for a complete image.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_ExportImage(uint8_t *image, uint8_t regions) {
+    uint8_t regs[DS3231_IMAGE_REGS];
+    HAL_StatusTypeDef status = DS3231_ReadRegisters(DS3231_REG_SECOND, regs, DS3231_IMAGE_REGS);
+    if (status != HAL_OK)
+        return status;
+    DS3231_Image_Build(regs, regions, image);
+    return status;
+}
+
+/**
+ * @brief Writes an image to the device.
+ * @details The carried regions are written as contiguous runs, see #DS3231_Image_Bursts; a full image is a single
+ * 17 byte burst. The time is advanced by elapsed seconds first, so a golden image taken once can be written to
+ * every board on the line with the time since it was taken. Writing the seconds register restarts the countdown
+ * chain, the sub-second phase is that of the write.\n
+ * A STATUS region clears A1F and A2F. OSF is only cleared when the image also sets the time.
+ * @param[in] *image Pass a pointer to #DS3231_IMAGE_SIZE bytes from #DS3231_ExportImage or #DS3231_Image_Build.
+ * @param[in] elapsed Seconds since the time in the image was valid.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR for an invalid image.
+ */
+HAL_StatusTypeDef DS3231_ImportImage(const uint8_t *image, uint32_t elapsed) {
+    HAL_StatusTypeDef status = DS3231_Image_Check(image);
+    uint8_t regs[DS3231_IMAGE_REGS];
+    const uint8_t regions = image[3];
+    uint8_t first, reg;
+    if (status != HAL_OK)
+        return status;
+    for (reg = 0; reg < DS3231_IMAGE_REGS; reg++)
+        regs[reg] = image[DS3231_IMAGE_HEADER + reg];
+    if (regions & DS3231_IMAGE_TIME) {
+        status = DS3231_Image_Advance(regs, elapsed);
+        if (status != HAL_OK)
+            return status;
+    } else {
+        regs[DS3231_REG_STATUS] |= (1 << DS3231_OSF);   // Writing 1 leaves OSF as it is.
+    }
+    for (first = 0; first < DS3231_IMAGE_REGS; first = reg) {
+        if (!(DS3231_image_region[first] & regions)) {
+            reg = first + 1;
+            continue;
+        }
+        for (reg = first + 1; reg < DS3231_IMAGE_REGS && (DS3231_image_region[reg] & regions); reg++)
+            ;
+        status = DS3231_WriteRegisters(first, &regs[first], reg - first);
+        if (status != HAL_OK)
+            return status;
+    }
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
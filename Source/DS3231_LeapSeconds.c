@@ -0,0 +1,187 @@
+/**
+ *  @brief     Leap second table for UTC, TAI and GPS conversions.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_LeapSeconds.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const DS3231_LeapEntry DS3231_LeapBuiltin[DS3231_LEAP_BUILTIN_COUNT] = {
+    { 63072000UL, 10 },         /* 1972-01-01, NTP 2272060800 */
+    { 78796800UL, 11 },         /* 1972-07-01 */
+    { 94694400UL, 12 },         /* 1973-01-01 */
+    { 126230400UL, 13 },        /* 1974-01-01 */
+    { 157766400UL, 14 },        /* 1975-01-01 */
+    { 189302400UL, 15 },        /* 1976-01-01 */
+    { 220924800UL, 16 },        /* 1977-01-01 */
+    { 252460800UL, 17 },        /* 1978-01-01 */
+    { 283996800UL, 18 },        /* 1979-01-01 */
+    { 315532800UL, 19 },        /* 1980-01-01 */
+    { 362793600UL, 20 },        /* 1981-07-01 */
+    { 394329600UL, 21 },        /* 1982-07-01 */
+    { 425865600UL, 22 },        /* 1983-07-01 */
+    { 489024000UL, 23 },        /* 1985-07-01 */
+    { 567993600UL, 24 },        /* 1988-01-01 */
+    { 631152000UL, 25 },        /* 1990-01-01 */
+    { 662688000UL, 26 },        /* 1991-01-01 */
+    { 709948800UL, 27 },        /* 1992-07-01 */
+    { 741484800UL, 28 },        /* 1993-07-01 */
+    { 773020800UL, 29 },        /* 1994-07-01 */
+    { 820454400UL, 30 },        /* 1996-01-01 */
+    { 867715200UL, 31 },        /* 1997-07-01 */
+    { 915148800UL, 32 },        /* 1999-01-01 */
+    { 1136073600UL, 33 },       /* 2006-01-01 */
+    { 1230768000UL, 34 },       /* 2009-01-01 */
+    { 1341100800UL, 35 },       /* 2012-07-01 */
+    { 1435708800UL, 36 },       /* 2015-07-01 */
+    { 1483228800UL, 37 },       /* 2017-01-01, NTP 3692217600 */
+};
+
+/* Caches segment s, from entry s - 1 up to entry s. Segment 0 lies before the table, Count after its end. */
+static uint8_t DS3231_Leap_Cache(DS3231_LeapTable *table, uint8_t segment) {
+    const DS3231_LeapEntry *e = table->Entries;
+    const uint32_t start = segment ? e[segment - 1].Unix : 0;
+    table->Segment = segment;
+    table->SegStart = start;
+    table->SegLength = (segment < table->Count ? e[segment].Unix : 0) - start;
+    table->SegTaiUtc = e[segment ? segment - 1 : 0].TaiUtc;
+    return table->SegTaiUtc;
+}
+
+/**
+ * @brief Initializes a leap second table.
+ * @param[out] *table Pass a pointer to a #DS3231_LeapTable structure.
+ * @param[in] *entries Pass a pointer to count entries sorted by unix time, kept by the table. NULL selects
+ * #DS3231_LeapBuiltin and its expiry, count and expires are ignored then.
+ * @param[in] count Number of entries, at least one.
+ * @param[in] expires Unix time the list expires at, the "#@" line of leap-seconds.list.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_Leap_Init(DS3231_LeapTable *table, const DS3231_LeapEntry *entries, uint8_t count,
+        uint32_t expires) {
+    if (entries == NULL) {
+        entries = DS3231_LeapBuiltin;
+        count = DS3231_LEAP_BUILTIN_COUNT;
+        expires = DS3231_LEAP_BUILTIN_EXPIRES;
+    }
+    if (count == 0)
+        return HAL_ERROR;
+    for (uint8_t i = 1; i < count; i++) {
+        if (entries[i].Unix <= entries[i - 1].Unix)
+            return HAL_ERROR;
+    }
+    table->Entries = entries;
+    table->Count = count;
+    table->Expires = expires;
+    // Most lookups are for the present, after the last entry.
+    DS3231_Leap_Cache(table, count);
+    return HAL_OK;
+}
+
+/**
+ * @brief Looks up TAI - UTC outside the cached segment and caches the segment the time falls into.
+ * @details Called by #DS3231_Leap_TaiUtc, a branch-free binary search over the entries.
+ * @param[in,out] *table Pass a pointer to an initialized #DS3231_LeapTable.
+ * @param[in] unixtime Unix time to look up.
+ * @return TAI - UTC in seconds.
+ */
+uint8_t DS3231_Leap_Seek(DS3231_LeapTable *table, uint32_t unixtime) {
+    const DS3231_LeapEntry *e = table->Entries;
+    uint8_t low = 0, count = table->Count;
+    // Fixed number of halvings with a conditional add, no branch on the data to mispredict.
+    while (count > 1) {
+        const uint8_t half = count / 2;
+        low = (uint8_t) (low + (e[low + half].Unix <= unixtime ? half : 0));
+        count = (uint8_t) (count - half);
+    }
+    return DS3231_Leap_Cache(table, (uint8_t) (low + (e[low].Unix <= unixtime)));
+}
+
+/**
+ * @brief Converts TAI seconds since 1970-01-01 00:00:00 TAI to unix time.
+ * @details During an inserted leap second unix time has no value of its own, *unixtime is set to 23:59:59
+ * before it, as on systems that repeat that second.
+ * @param[in,out] *table Pass a pointer to an initialized #DS3231_LeapTable.
+ * @param[in] tai TAI seconds, e.g. the upper half of a PTP timestamp.
+ * @param[out] *unixtime Pass a pointer to uint32_t variable to get the unix time.
+ * @return 1 during an inserted leap second, 0 otherwise.
+ */
+uint8_t DS3231_Leap_FromTAI(DS3231_LeapTable *table, uint32_t tai, uint32_t *unixtime) {
+    const DS3231_LeapEntry *e = table->Entries;
+    uint8_t low = 0, high = table->Count;
+    uint32_t candidate = tai - table->SegTaiUtc;
+    if (candidate - table->SegStart < table->SegLength) {
+        *unixtime = candidate;
+        return 0;
+    }
+    // Entries start at Unix + TaiUtc on the TAI scale, the leap second is the TAI second before that.
+    while (low < high) {
+        const uint8_t mid = (uint8_t) ((low + high) / 2);
+        if (e[mid].Unix + e[mid].TaiUtc <= tai)
+            low = (uint8_t) (mid + 1);
+        else
+            high = mid;
+    }
+    candidate = tai - DS3231_Leap_Cache(table, low);
+    if (low < table->Count && candidate >= e[low].Unix) {
+        *unixtime = e[low].Unix - 1;
+        return 1;
+    }
+    *unixtime = candidate;
+    return 0;
+}
+
+#if DS3231_USE_CONVERSIONS
+/**
+ * @brief Converts TAI seconds to broken down UTC, 23:59:60 during an inserted leap second.
+ * @param[in,out] *table Pass a pointer to an initialized #DS3231_LeapTable.
+ * @param[in] tai TAI seconds since 1970-01-01 00:00:00 TAI.
+ * @param[out] *dt Pass a pointer to #DS3231_DateTime type variable, Second is 0..60.
+ * @return void
+ */
+void DS3231_Leap_ToDateTime(DS3231_LeapTable *table, uint32_t tai, DS3231_DateTime *dt) {
+    uint32_t unixtime;
+    const uint8_t leap = DS3231_Leap_FromTAI(table, tai, &unixtime);
+    DS3231_ToDateTime(&unixtime, dt);
+    if (leap)
+        dt->Second = 60;
+}
+
+/**
+ * @brief Converts broken down UTC to TAI seconds, accepting 23:59:60 of a day that ends with a leap second.
+ * @param[in,out] *table Pass a pointer to an initialized #DS3231_LeapTable.
+ * @param[in] *dt Pass a pointer to #DS3231_DateTime type variable, from 1970 on, Second is 0..60.
+ * @param[out] *tai Pass a pointer to uint32_t variable to get TAI seconds since 1970-01-01 00:00:00 TAI.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not. HAL_ERROR for a second 60 the
+ * table has no leap second for.
+ */
+HAL_StatusTypeDef DS3231_Leap_FromDateTime(DS3231_LeapTable *table, DS3231_DateTime *dt, uint32_t *tai) {
+    DS3231_DateTime before;
+    uint32_t unixtime = 0;
+    uint8_t offset;
+    if (dt->Second < 60) {
+        DS3231_ToUnixTime(dt, &unixtime);
+        *tai = DS3231_Leap_ToTAI(table, unixtime);
+        return HAL_OK;
+    }
+    if (dt->Second > 60)
+        return HAL_ERROR;
+    before = *dt;
+    before.Second = 59;
+    DS3231_ToUnixTime(&before, &unixtime);
+    offset = DS3231_Leap_TaiUtc(table, unixtime);
+    if (DS3231_Leap_TaiUtc(table, unixtime + 1) != offset + 1)
+        return HAL_ERROR;
+    *tai = unixtime + offset + 1;
+    return HAL_OK;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
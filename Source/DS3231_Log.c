@@ -0,0 +1,134 @@
+/**
+ *  @brief     Time-indexed binary log format for DS3231 stamped records.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Log.h"
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts a new, empty block.
+ * @param[out] *blk Pass a pointer to #DS3231_LogBlock type variable.
+ * @param[in] *buffer Pass a pointer to the block buffer.
+ * @param[in] size Block size in bytes, e.g. a flash page or sector.
+ * @param[in] record_size Bytes per record including the 4 byte unix time.
+ * @param[in] sequence Block number in the log, the first block is 0.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR when no record fits.
+ */
+HAL_StatusTypeDef DS3231_LogBlock_Begin(DS3231_LogBlock *blk, uint8_t *buffer, uint32_t size, uint16_t record_size,
+        uint32_t sequence) {
+    uint32_t capacity;
+    if (record_size < 4 || size < DS3231_LOG_HEADER_SIZE + (uint32_t) record_size)
+        return HAL_ERROR;
+    capacity = (size - DS3231_LOG_HEADER_SIZE) / record_size;
+    memset(buffer, 0, size);
+    DS3231_LogPut32(&buffer[DS3231_LOG_OFS_MAGIC], DS3231_LOG_BLOCK_MAGIC);
+    DS3231_LogPut16(&buffer[DS3231_LOG_OFS_VERSION], DS3231_LOG_VERSION);
+    DS3231_LogPut16(&buffer[DS3231_LOG_OFS_HEADER_SIZE], DS3231_LOG_HEADER_SIZE);
+    DS3231_LogPut32(&buffer[DS3231_LOG_OFS_BLOCK_SIZE], size);
+    DS3231_LogPut32(&buffer[DS3231_LOG_OFS_SEQUENCE], sequence);
+    DS3231_LogPut16(&buffer[DS3231_LOG_OFS_RECORD_SIZE], record_size);
+    blk->Buffer = buffer;
+    blk->Size = size;
+    blk->RecordSize = record_size;
+    blk->Records = 0;
+    blk->Capacity = capacity > 0xFFFF ? 0xFFFF : (uint16_t) capacity;
+    return HAL_OK;
+}
+
+/**
+ * @brief Appends a record and updates the block's time range.
+ * @param[in,out] *blk Pass a pointer to #DS3231_LogBlock type variable.
+ * @param[in] unixtime Time of the record, not earlier than the previous record.
+ * @param[in] *payload Pass a pointer to record_size - 4 bytes, or NULL to leave the payload zeroed.
+ * @return 1 when stored, 0 when the block is full. Store the block and begin the next one.
+ */
+uint8_t DS3231_LogBlock_Append(DS3231_LogBlock *blk, uint32_t unixtime, const uint8_t *payload) {
+    uint8_t *record;
+    if (blk->Records >= blk->Capacity)
+        return 0;
+    record = blk->Buffer + DS3231_LOG_HEADER_SIZE + (uint32_t) blk->Records * blk->RecordSize;
+    DS3231_LogPut32(record, unixtime);
+    if (payload != NULL)
+        memcpy(record + 4, payload, blk->RecordSize - 4U);
+    if (blk->Records == 0)
+        DS3231_LogPut32(&blk->Buffer[DS3231_LOG_OFS_MIN_TIME], unixtime);
+    DS3231_LogPut32(&blk->Buffer[DS3231_LOG_OFS_MAX_TIME], unixtime);
+    DS3231_LogPut16(&blk->Buffer[DS3231_LOG_OFS_RECORDS], ++blk->Records);
+    return 1;
+}
+
+/**
+ * @brief Footer size for a log.
+ * @param[in] blocks Number of blocks in the log.
+ * @param[in] stride One index entry per stride blocks.
+ * @return Bytes needed by #DS3231_LogIndex_Begin.
+ */
+uint32_t DS3231_LogIndex_Size(uint32_t blocks, uint32_t stride) {
+    return (blocks + stride - 1) / stride * DS3231_LOG_ENTRY_SIZE + DS3231_LOG_TRAILER_SIZE;
+}
+
+/**
+ * @brief Starts building the sparse index footer.
+ * @param[out] *idx Pass a pointer to #DS3231_LogIndex type variable.
+ * @param[in] *buffer Pass a pointer to the footer buffer.
+ * @param[in] size Footer buffer size in bytes.
+ * @param[in] stride One index entry per stride blocks.
+ * @param[in] block_size Block size of the log.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_LogIndex_Begin(DS3231_LogIndex *idx, uint8_t *buffer, uint32_t size, uint32_t stride,
+        uint32_t block_size) {
+    if (stride == 0 || size < DS3231_LOG_TRAILER_SIZE)
+        return HAL_ERROR;
+    idx->Buffer = buffer;
+    idx->Capacity = (size - DS3231_LOG_TRAILER_SIZE) / DS3231_LOG_ENTRY_SIZE;
+    idx->Entries = 0;
+    idx->Stride = stride;
+    idx->BlockSize = block_size;
+    return HAL_OK;
+}
+
+/**
+ * @brief Feeds a finished block to the index, call it for every block in order.
+ * @param[in,out] *idx Pass a pointer to #DS3231_LogIndex type variable.
+ * @param[in] *block Pass a pointer to the finished block.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR when the footer is full.
+ */
+HAL_StatusTypeDef DS3231_LogIndex_Add(DS3231_LogIndex *idx, const uint8_t *block) {
+    uint32_t sequence = DS3231_LogGet32(&block[DS3231_LOG_OFS_SEQUENCE]);
+    uint8_t *entry;
+    if (sequence % idx->Stride)
+        return HAL_OK;
+    if (idx->Entries >= idx->Capacity)
+        return HAL_ERROR;
+    entry = idx->Buffer + idx->Entries++ * DS3231_LOG_ENTRY_SIZE;
+    DS3231_LogPut32(entry, DS3231_LogGet32(&block[DS3231_LOG_OFS_MIN_TIME]));
+    DS3231_LogPut32(entry + 4, sequence);
+    return HAL_OK;
+}
+
+/**
+ * @brief Writes the trailer after the index entries.
+ * @param[in,out] *idx Pass a pointer to #DS3231_LogIndex type variable.
+ * @return Footer size in bytes, append this many bytes of the buffer after the last block.
+ */
+uint32_t DS3231_LogIndex_Finish(DS3231_LogIndex *idx) {
+    uint8_t *trailer = idx->Buffer + idx->Entries * DS3231_LOG_ENTRY_SIZE;
+    DS3231_LogPut32(trailer, DS3231_LOG_INDEX_MAGIC);
+    DS3231_LogPut32(trailer + 4, idx->Entries);
+    DS3231_LogPut32(trailer + 8, idx->Stride);
+    DS3231_LogPut32(trailer + 12, idx->BlockSize);
+    return idx->Entries * DS3231_LOG_ENTRY_SIZE + DS3231_LOG_TRAILER_SIZE;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+/**
+ *  @brief     Packed 32-bit timestamp for the DS3231 library.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Packed.h"
+#include "DS3231_calendar.h"
+
+#if DS3231_USE_CONVERSIONS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Packs a broken down Date Time into a #DS3231_Packed timestamp.
+ * @param[in] *dt Pass a pointer to #DS3231_DateTime type variable.
+ * @param[out] *packed Pass a pointer to #DS3231_Packed type variable, left untouched on error.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not. HAL_ERROR for a year outside
+ * #DS3231_PACKED_EPOCH to #DS3231_PACKED_LAST_YEAR.
+ * @note The Day and Enable members are not stored.
+ */
+HAL_StatusTypeDef DS3231_ToPacked(DS3231_DateTime *dt, DS3231_Packed *packed) {
+    if ((uint16_t) (dt->Year - DS3231_PACKED_EPOCH) > DS3231_PACKED_LAST_YEAR - DS3231_PACKED_EPOCH)
+        return HAL_ERROR;
+    *packed = (uint32_t) ((dt->Year - DS3231_PACKED_EPOCH) & 0x3F) << DS3231_PACKED_YEAR_POS
+            | (uint32_t) (dt->Month & 0x0F) << DS3231_PACKED_MONTH_POS
+            | (uint32_t) (dt->Date & 0x1F) << DS3231_PACKED_DATE_POS
+            | (uint32_t) (dt->Hour_24mode & 0x1F) << DS3231_PACKED_HOUR_POS
+            | (uint32_t) (dt->Minute & 0x3F) << DS3231_PACKED_MINUTE_POS
+            | (uint32_t) (dt->Second & 0x3F) << DS3231_PACKED_SECOND_POS;
+    return HAL_OK;
+}
+
+/**
+ * @brief Unpacks a #DS3231_Packed timestamp into a broken down Date Time.
+ * @param[in] *packed Pass a pointer to #DS3231_Packed type variable.
+ * @param[out] *dt Pass a pointer to #DS3231_DateTime type variable.
+ * @return void
+ * @note Day is recomputed from the date, Enable is set to #DS3231_ENABLED.
+ */
+void DS3231_FromPacked(DS3231_Packed *packed, DS3231_DateTime *dt) {
+    uint32_t p = *packed;
+    dt->Year = DS3231_PACKED_YEAR(p);
+    dt->Month = DS3231_PACKED_MONTH(p);
+    dt->Date = DS3231_PACKED_DATE(p);
+    dt->Hour_24mode = DS3231_PACKED_HOUR(p);
+    dt->Minute = DS3231_PACKED_MINUTE(p);
+    dt->Second = DS3231_PACKED_SECOND(p);
+    dt->Day = DS3231_DayOfWeek(dt->Year, dt->Month, dt->Date);
+    dt->Enable = DS3231_ENABLED;
+}
+
+/**
+ * @brief Packs the raw time registers 0x00 to 0x06 without going through #DS3231_DateTime.
+ * @param[in] *regs Pass a pointer to the 7 bytes read from #DS3231_REG_SECOND onwards.
+ * @param[out] *packed Pass a pointer to #DS3231_Packed type variable, left untouched on error.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not. HAL_ERROR for a year outside
+ * #DS3231_PACKED_EPOCH to #DS3231_PACKED_LAST_YEAR.
+ * @note The century bit adds 100 years. The hour may be in either hour mode.
+ */
+HAL_StatusTypeDef DS3231_PackRegisters(uint8_t *regs, DS3231_Packed *packed) {
+    uint16_t year = DS3231_DecodeBCD(regs[6]) + 2000U + ((regs[5] >> DS3231_CENTURY) & 0x01) * 100U;
+    if ((uint16_t) (year - DS3231_PACKED_EPOCH) > DS3231_PACKED_LAST_YEAR - DS3231_PACKED_EPOCH)
+        return HAL_ERROR;
+    *packed = (uint32_t) ((year - DS3231_PACKED_EPOCH) & 0x3F) << DS3231_PACKED_YEAR_POS
+            | (uint32_t) DS3231_DecodeBCD(regs[5] & 0x1F) << DS3231_PACKED_MONTH_POS
+            | (uint32_t) DS3231_DecodeBCD(regs[4] & 0x3F) << DS3231_PACKED_DATE_POS
+            | (uint32_t) DS3231_Hour_Decode(regs[2]) << DS3231_PACKED_HOUR_POS
+            | (uint32_t) DS3231_DecodeBCD(regs[1] & 0x7F) << DS3231_PACKED_MINUTE_POS
+            | (uint32_t) DS3231_DecodeBCD(regs[0] & 0x7F) << DS3231_PACKED_SECOND_POS;
+    return HAL_OK;
+}
+
+/**
+ * @brief Unpacks a #DS3231_Packed timestamp into the 7 time registers, ready for #DS3231_WriteRegisters.
+ * @details Goes through #DS3231_EncodeDateTime, so years from 2100 on set the century bit.
+ * @param[in] *packed Pass a pointer to #DS3231_Packed type variable.
+ * @param[in] mode Hour mode to encode the hour in, pass that of the device (#DS3231_GetHourMode) so that writing
+ * the registers does not switch it.
+ * @param[out] *regs Pass a pointer to a 7 byte buffer, valid only when the mask is 0.
+ * @return Mask of #DS3231_EncodeDateTime, 0 when the timestamp is a valid time from 2000 to 2199.
+ */
+uint8_t DS3231_UnpackRegisters(DS3231_Packed *packed, DS3231_HourMode mode, uint8_t *regs) {
+    DS3231_DateTime dt;
+    DS3231_FromPacked(packed, &dt);
+    return DS3231_EncodeDateTime(&dt, mode, regs);
+}
+
+/**
+ * @brief Reads the current time straight into a #DS3231_Packed timestamp.
+ * @param[out] *packed Pass a pointer to #DS3231_Packed type variable.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR also when the year read
+ * cannot be packed.
+ * @note Unlike #DS3231_GetDateTime this is a single 7 byte read, the oscillator stop flag is not read.
+ */
+HAL_StatusTypeDef DS3231_GetPacked(DS3231_Packed *packed) {
+    HAL_StatusTypeDef status;
+    uint8_t buffer[7];
+    status = DS3231_ReadRegisters(DS3231_REG_SECOND, buffer, 7);
+    if (status != HAL_OK)
+        return status;
+    return DS3231_PackRegisters(buffer, packed);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DS3231_USE_CONVERSIONS */
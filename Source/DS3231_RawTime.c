@@ -0,0 +1,44 @@
+/**
+ *  @brief     Zero-copy view of the DS3231 time registers with lazy field decoding.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_RawTime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Reads the time registers without decoding them.
+ * @param[out] *raw Pass a pointer to #DS3231_RawTime type variable.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ * @note A single 7 byte read, the oscillator stop flag is not read.
+ */
+HAL_StatusTypeDef DS3231_GetRawTime(DS3231_RawTime *raw) {
+    return DS3231_ReadRegisters(DS3231_REG_SECOND, raw->Regs, sizeof(raw->Regs));
+}
+
+/**
+ * @brief Decodes every field of a raw time into a broken down Date Time.
+ * @param[in] *raw Pass a pointer to #DS3231_RawTime type variable.
+ * @param[out] *dt Pass a pointer to #DS3231_DateTime type variable.
+ * @return void
+ * @note Enable is set to #DS3231_ENABLED, the status register is not part of the raw time.
+ */
+void DS3231_RawTime_ToDateTime(const DS3231_RawTime *raw, DS3231_DateTime *dt) {
+    dt->Second = DS3231_RawTime_Second(raw);
+    dt->Minute = DS3231_RawTime_Minute(raw);
+    dt->Hour_24mode = DS3231_RawTime_Hour(raw);
+    dt->Day = DS3231_RawTime_Day(raw);
+    dt->Date = DS3231_RawTime_Date(raw);
+    dt->Month = DS3231_RawTime_Month(raw);
+    dt->Year = DS3231_RawTime_Year(raw);
+    dt->Enable = DS3231_ENABLED;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,95 @@
+/**
+ *  @brief     Battery-backed scratchpad in the Alarm 2 registers of the DS3231.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Scratchpad.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Computes the check code stored next to the scratchpad data.
+ * @details CRC-5 with polynomial x^5 + x^2 + 1 over the 16 data bits, most significant first, started from 0x1F
+ * so that all-zero registers do not pass.
+ * @param[in] data Scratchpad data.
+ * @return 5-bit check code.
+ */
+uint8_t DS3231_Scratchpad_Check(uint16_t data) {
+    uint8_t crc = DS3231_SCRATCHPAD_CHECK;
+    for (int8_t bit = 15; bit >= 0; bit--) {
+        uint8_t feedback = (uint8_t) (((crc >> 4) ^ (data >> bit)) & 0x01);
+        crc = (uint8_t) ((crc << 1) & DS3231_SCRATCHPAD_CHECK);
+        if (feedback)
+            crc ^= 0x05;
+    }
+    return crc;
+}
+
+/**
+ * @brief Builds the register image of the scratchpad.
+ * @param[in] data Scratchpad data.
+ * @param[out] *regs Pass a pointer to a uint8_t buffer of #DS3231_SCRATCHPAD_LEN bytes, written to 0x0B..0x0D.
+ * @return void
+ */
+void DS3231_Scratchpad_Pack(uint16_t data, uint8_t *regs) {
+    regs[0] = (uint8_t) (DS3231_SCRATCHPAD_MARK | DS3231_Scratchpad_Check(data));
+    regs[1] = (uint8_t) (data >> 8);
+    regs[2] = (uint8_t) data;
+}
+
+/**
+ * @brief Checks and decodes a register image of the scratchpad.
+ * @param[in] *regs Pass a pointer to the #DS3231_SCRATCHPAD_LEN bytes read from 0x0B..0x0D.
+ * @param[out] *data Pass a pointer to uint16_t type variable, only written if the image is valid.
+ * @return HAL_OK if the image holds scratchpad data, HAL_ERROR if the mark or the check code does not match.
+ */
+HAL_StatusTypeDef DS3231_Scratchpad_Unpack(const uint8_t *regs, uint16_t *data) {
+    uint16_t value = (uint16_t) (regs[1] << 8 | regs[2]);
+    if ((regs[0] & DS3231_SCRATCHPAD_MARK_MASK) != DS3231_SCRATCHPAD_MARK
+            || (regs[0] & DS3231_SCRATCHPAD_CHECK) != DS3231_Scratchpad_Check(value))
+        return HAL_ERROR;
+    *data = value;
+    return HAL_OK;
+}
+
+/**
+ * @brief Reads the scratchpad.
+ * @details One burst read of 0x0B..0x0E, the control register tells whether Alarm 2 is in use.
+ * @param[out] *data Pass a pointer to uint16_t type variable.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR if A2IE is set or the
+ * registers do not hold scratchpad data (never written, battery lost or alarm reprogrammed).
+ */
+HAL_StatusTypeDef DS3231_Scratchpad_Read(uint16_t *data) {
+    uint8_t buffer[DS3231_SCRATCHPAD_LEN + 1];
+    HAL_StatusTypeDef status = DS3231_ReadRegisters(DS3231_SCRATCHPAD_REG, buffer, sizeof(buffer));
+    if (status != HAL_OK)
+        return status;
+    if (buffer[DS3231_REG_CONTROL - DS3231_SCRATCHPAD_REG] & (1 << DS3231_A2IE))
+        return HAL_ERROR;
+    return DS3231_Scratchpad_Unpack(buffer, data);
+}
+
+/**
+ * @brief Writes the scratchpad.
+ * @details Reads the control register and writes 0x0B..0x0D in one burst unless A2IE is set.
+ * @param[in] data Scratchpad data.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not, HAL_ERROR if A2IE is set.
+ */
+HAL_StatusTypeDef DS3231_Scratchpad_Write(uint16_t data) {
+    uint8_t control, buffer[DS3231_SCRATCHPAD_LEN];
+    HAL_StatusTypeDef status = DS3231_ReadRegister(DS3231_REG_CONTROL, &control);
+    if (status != HAL_OK)
+        return status;
+    if (control & (1 << DS3231_A2IE))
+        return HAL_ERROR;
+    DS3231_Scratchpad_Pack(data, buffer);
+    return DS3231_WriteRegisters(DS3231_SCRATCHPAD_REG, buffer, DS3231_SCRATCHPAD_LEN);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,232 @@
+/**
+ *  @brief     Deferred conversion of captured counter ticks to unix time for the DS3231 library.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_TickMap.h"
+#include "DS3231_RawTime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DS3231_TICKMAP_AT(map, i)   (&(map)->Anchors[((map)->Head + (i)) % DS3231_TICKMAP_ANCHORS])
+#define DS3231_TICKMAP_SPAN         8       /* Anchors the rate after the newest one is measured over */
+
+/* (ticks * rate) >> 32 in 32x32 bit products, no 128 bit type needed. */
+static uint64_t DS3231_TickMap_Scale(uint64_t ticks, uint64_t rate) {
+    uint64_t t1 = ticks >> 32, t0 = (uint32_t) ticks, r1 = rate >> 32, r0 = (uint32_t) rate;
+    return ((t1 * r1) << 32) + t1 * r0 + t0 * r1 + ((t0 * r0) >> 32);
+}
+
+/* time / ticks as 32.32 fixed point, by long division for the fraction. */
+static uint64_t DS3231_TickMap_Divide(uint64_t time, uint64_t ticks) {
+    uint64_t rate = (time / ticks) << 32, rem = time % ticks;
+    for (int8_t bit = 31; bit >= 0; bit--) {
+        rem <<= 1;
+        if (rem >= ticks) {
+            rem -= ticks;
+            rate |= (uint64_t) 1 << bit;
+        }
+    }
+    return rate;
+}
+
+/* Time of an extended tick on the segment starting at anchor a, extrapolated outside of it. */
+static uint64_t DS3231_TickMap_Interpolate(const DS3231_TickAnchor *a, uint64_t tick) {
+    int64_t offset = (int64_t) (tick - a->Tick);
+    if (offset >= 0)
+        return a->Time + DS3231_TickMap_Scale((uint64_t) offset, a->Rate);
+    return a->Time - DS3231_TickMap_Scale((uint64_t) -offset, a->Rate);
+}
+
+/* Appends an anchor at an extended tick, closing the previous segment with its measured rate. */
+static void DS3231_TickMap_Insert(DS3231_TickMap *map, uint64_t tick, uint64_t time) {
+    DS3231_TickAnchor *a;
+    uint64_t rate = map->NominalRate;
+    if (map->Count > 0) {
+        DS3231_TickAnchor *newest = DS3231_TICKMAP_AT(map, map->Count - 1);
+        if ((int64_t) (tick - newest->Tick) <= 0)
+            return;
+        if (time <= newest->Time) {
+            // The clock was set back, the old segments no longer describe it.
+            map->Count = 0;
+        } else {
+            // Extrapolate over a longer span, a single poll anchored segment can be off by its window / 1 s.
+            const DS3231_TickAnchor *from = DS3231_TICKMAP_AT(map, map->Count > DS3231_TICKMAP_SPAN
+                    ? map->Count - DS3231_TICKMAP_SPAN : 0);
+            newest->Rate = DS3231_TickMap_Divide(time - newest->Time, tick - newest->Tick);
+            rate = DS3231_TickMap_Divide(time - from->Time, tick - from->Tick);
+        }
+    }
+    if (map->Count == DS3231_TICKMAP_ANCHORS) {
+        map->Head = (map->Head + 1) % DS3231_TICKMAP_ANCHORS;
+        map->Count--;
+    }
+    a = DS3231_TICKMAP_AT(map, map->Count);
+    a->Tick = tick;
+    a->Time = time;
+    a->Rate = rate;
+    map->Count++;
+}
+
+/**
+ * @brief Initializes an empty tick map.
+ * @param[out] *map Pass a pointer to a #DS3231_TickMap structure.
+ * @param[in] tick_hz Nominal counter frequency, 2 Hz or more. Used until the second anchor measures it.
+ * @param[in] tick_bits Counter width, 1 to 32, e.g. 32 for the DWT cycle counter or 24 for SysTick.
+ * @return void
+ */
+void DS3231_TickMap_Init(DS3231_TickMap *map, uint32_t tick_hz, uint8_t tick_bits) {
+    map->Mask = tick_bits >= 32 ? 0xFFFFFFFFUL : (1UL << tick_bits) - 1;
+    map->NominalRate = UINT64_MAX / tick_hz;
+    map->LastTick = 0;
+    map->LastRaw = 0;
+    map->Started = 0;
+    DS3231_TickMap_Reset(map);
+}
+
+/**
+ * @brief Drops all anchors, e.g. after the RTC was set. The counter extension is kept.
+ * @param[in,out] *map Pass a pointer to a #DS3231_TickMap structure.
+ * @return void
+ */
+void DS3231_TickMap_Reset(DS3231_TickMap *map) {
+    map->Head = 0;
+    map->Count = 0;
+    map->PollValid = 0;
+#if DS3231_USE_CACHE
+    map->Generation = DS3231_GetTimeGeneration();
+#endif
+}
+
+/**
+ * @brief Extends the current counter value to 64 bits.
+ * @param[in,out] *map Pass a pointer to a #DS3231_TickMap structure.
+ * @param[in] now Counter value read now, it must not lie more than one counter period after the last one seen.
+ * @return Extended tick.
+ */
+uint64_t DS3231_TickMap_Extend(DS3231_TickMap *map, uint32_t now) {
+    now &= map->Mask;
+    if (!map->Started) {
+        map->LastTick = now;
+        map->Started = 1;
+    } else {
+        map->LastTick += (now - map->LastRaw) & map->Mask;
+    }
+    map->LastRaw = now;
+    return map->LastTick;
+}
+
+/**
+ * @brief Adds an anchor: the counter read tick at the given unix time.
+ * @details Use it with exact edges, e.g. a tick captured in the 1 Hz SQW interrupt together with the second it
+ * starts, or see #DS3231_TickMap_Poll. An anchor that is not newer than the newest one is ignored; an anchor
+ * earlier in time than the newest one starts the map over.
+ * @param[in,out] *map Pass a pointer to a #DS3231_TickMap structure.
+ * @param[in] tick Counter value at the anchor, within half a counter period of the newest tick seen.
+ * @param[in] time Unix time at the anchor, see #DS3231_TICKMAP_TIME.
+ * @return void
+ */
+void DS3231_TickMap_AddAnchor(DS3231_TickMap *map, uint32_t tick, uint64_t time) {
+    uint32_t behind = (map->LastRaw - tick) & map->Mask;
+    uint64_t extended;
+    if (map->Started && behind != 0 && behind <= map->Mask / 2)
+        extended = map->LastTick - behind;
+    else
+        extended = DS3231_TickMap_Extend(map, tick);
+    DS3231_TickMap_Insert(map, extended, time);
+}
+
+/**
+ * @brief Converts a batch of captured ticks to unix time.
+ * @details Each tick is placed on the segment between the two anchors around it by binary search, consecutive
+ * ticks on the same segment skip the search, so a batch in capture order costs little more than the
+ * interpolation. Ticks after the newest anchor are extrapolated with the rate measured over the last eight anchors,
+ * ticks before the oldest one with the oldest rate.
+ * @param[in,out] *map Pass a pointer to a #DS3231_TickMap structure.
+ * @param[in] now Counter value read now, after every tick of the batch was captured.
+ * @param[in] *ticks Captured counter values, each less than one counter period before now.
+ * @param[out] *times Pass a pointer to count uint64_t, unix time in 32.32 fixed point.
+ * @param[in] count Number of ticks.
+ * @return HAL_OK, HAL_ERROR if the map has no anchor yet.
+ */
+HAL_StatusTypeDef DS3231_TickMap_Resolve(DS3231_TickMap *map, uint32_t now, const uint32_t *ticks, uint64_t *times,
+        uint32_t count) {
+    const uint64_t last = DS3231_TickMap_Extend(map, now);
+    const uint64_t oldest = map->Count ? DS3231_TICKMAP_AT(map, 0)->Tick : 0;
+    uint32_t lo, hi, segment = 0;
+    if (map->Count == 0)
+        return HAL_ERROR;
+    for (uint32_t n = 0; n < count; n++) {
+        const uint64_t tick = last - ((map->LastRaw - ticks[n]) & map->Mask);
+        const uint64_t key = tick - oldest;
+        // Still on the segment of the previous tick?
+        if ((int64_t) key < 0 || key < DS3231_TICKMAP_AT(map, segment)->Tick - oldest
+                || (segment + 1 < map->Count && key >= DS3231_TICKMAP_AT(map, segment + 1)->Tick - oldest)) {
+            // Last anchor at or before the tick, the oldest one for ticks before it.
+            lo = 0;
+            hi = map->Count - 1;
+            if ((int64_t) key < 0)
+                hi = 0;
+            while (lo < hi) {
+                uint32_t mid = (lo + hi + 1) / 2;
+                if (DS3231_TICKMAP_AT(map, mid)->Tick - oldest <= key)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+            segment = lo;
+        }
+        times[n] = DS3231_TickMap_Interpolate(DS3231_TICKMAP_AT(map, segment), tick);
+    }
+    return HAL_OK;
+}
+
+#if DS3231_USE_CONVERSIONS
+/**
+ * @brief Anchors the map to the RTC by polling, for boards without the SQW edge on an interrupt.
+ * @details Each call reads the counter, the time registers and the counter again. When the seconds differ from
+ * the previous call's, the new second started between the two reads and its start is anchored half way between
+ * them, provided they lie at most max_window ticks apart; the error is at most half that window. Calling it at a
+ * fixed rate gives an anchor per second change, calling it faster just before an expected change gives tighter
+ * anchors. With #DS3231_USE_CACHE a time set through the library drops the map.
+ * @param[in,out] *map Pass a pointer to a #DS3231_TickMap structure.
+ * @param[in] read_tick Function returning the current counter value.
+ * @param[in] max_window Widest poll interval in ticks that still gives an anchor.
+ * @return HAL_StatusTypeDef variable describing if it was successful or not.
+ */
+HAL_StatusTypeDef DS3231_TickMap_Poll(DS3231_TickMap *map, uint32_t (*read_tick)(void), uint32_t max_window) {
+    DS3231_RawTime raw;
+    DS3231_DateTime dt;
+    uint32_t before, after, unixtime = 0;
+    uint64_t sample;
+    HAL_StatusTypeDef status;
+
+    before = read_tick();
+    status = DS3231_GetRawTime(&raw);
+    after = read_tick();
+    if (status != HAL_OK)
+        return status;
+    sample = DS3231_TickMap_Extend(map, after) - (((after - before) & map->Mask) / 2);
+#if DS3231_USE_CACHE
+    if (map->Generation != DS3231_GetTimeGeneration())
+        DS3231_TickMap_Reset(map);
+#endif
+    if (map->PollValid && raw.Regs[0] != map->PollSecond && sample - map->PollTick <= max_window) {
+        DS3231_RawTime_ToDateTime(&raw, &dt);
+        DS3231_ToUnixTime(&dt, &unixtime);
+        DS3231_TickMap_Insert(map, map->PollTick + (sample - map->PollTick) / 2, DS3231_TICKMAP_TIME(unixtime, 0));
+    }
+    map->PollSecond = raw.Regs[0];
+    map->PollTick = sample;
+    map->PollValid = 1;
+    return status;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+/**
+ *  @brief     Gregorian calendar helpers shared by the DS3231 library sources.
+ *  @details   Private to Source/, not part of the API. Months run 1..12 and days of week #DS3231_MON to
+ *             #DS3231_SUN as in the DAY register.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef DS3231_CALENDAR_H
+#define DS3231_CALENDAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DS3231.h"
+
+/**
+ * @brief Tells a leap year. A multiple of 100 is a multiple of 400 when it is also one of 16.
+ */
+static inline uint8_t DS3231_IsLeap(uint16_t year) {
+    return (uint8_t) (((year & 0x03) == 0) & ((year % 100U != 0) | ((year & 0x0F) == 0)));
+}
+
+/**
+ * @brief Days from the first of the year to the first of a month 1..12, leap day included.
+ */
+static inline uint16_t DS3231_DaysBeforeMonth(uint16_t year, uint8_t month) {
+    static const uint16_t days_before_month[13] = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+    return (uint16_t) (days_before_month[month] + ((month > 2) & DS3231_IsLeap(year)));
+}
+
+/**
+ * @brief Days from 1970-01-01 to the first of a year from 1970 on, 477 leap days fall before 1970.
+ */
+static inline uint32_t DS3231_DaysBeforeYear(uint16_t year) {
+    const uint32_t years = year - 1U;
+    return 365UL * (year - 1970U) + years / 4U - years / 100U + years / 400U - 477U;
+}
+
+/**
+ * @brief Day of week (#DS3231_MON to #DS3231_SUN) using Sakamoto's method.
+ */
+static inline uint8_t DS3231_DayOfWeek(uint16_t year, uint8_t month, uint8_t date) {
+    static const uint8_t dow[13] = { 0, 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    uint8_t day;
+    year -= month < 3;
+    day = (uint8_t) ((year + year / 4U - year / 100U + year / 400U + dow[month] + date) % 7U);
+    return day ? day : DS3231_SUN;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
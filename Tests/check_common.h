@@ -0,0 +1,61 @@
+/**
+ *  @brief     Fixture shared by the check_* programs.
+ *  @details   The simulator on its I2C handle, the failure count and the report at the end of main. Each check
+ *             program is a single source file and includes this header once. A failed check prints its name
+ *             through #check_failed, the program adds the values that explain it and ends the line. Define
+ *             CHECK_REPORT_LIMIT before the include to print fewer failures.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#ifndef CHECK_COMMON_H
+#define CHECK_COMMON_H
+
+#include "DS3231_Sim.h"
+
+#include <stdio.h>
+
+#ifndef CHECK_REPORT_LIMIT
+#define CHECK_REPORT_LIMIT  20      /* Failures printed, the ones after are only counted */
+#endif
+
+static DS3231_Sim sim;
+static I2C_HandleTypeDef hi2c;
+static unsigned failures;
+
+/**
+ * @brief Counts a failed check and starts its message.
+ * @param[in] ok Result of the check.
+ * @param[in] *what Name of the check.
+ * @return 1 when the failure was printed and the caller should finish the line, 0 otherwise.
+ */
+static inline int check_failed(int ok, const char *what) {
+    if (ok || failures++ >= CHECK_REPORT_LIMIT)
+        return 0;
+    fprintf(stderr, "%s failed", what);
+    return 1;
+}
+
+/**
+ * @brief Powers up a fresh simulator and routes hi2c to it.
+ */
+static inline void check_sim_start(void) {
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+}
+
+/**
+ * @brief Prints the outcome of the program.
+ * @param[in] *name What the program checks, for the success line.
+ * @return Exit code for main, 1 if any check failed.
+ */
+static inline int check_report(const char *name) {
+    if (failures) {
+        fprintf(stderr, "%u failure(s)\n", failures);
+        return 1;
+    }
+    printf("%s: all checks passed\n", name);
+    return 0;
+}
+
+#endif
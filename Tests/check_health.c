@@ -0,0 +1,162 @@
+/**
+ *  @brief     Checks of the DS3231 health monitor against the simulator.
+ *  @details   Runs the monitor task loop on simulated time. Starting from a healthy clock, it injects one fault
+ *             at a time: OSF, a BSY bit that stays set, a dead bus, time registers rewritten behind the
+ *             library's back, a clock that stopped and a temperature excursion. For each fault it checks that
+ *             the flag appears within one slow period, that the period drops to fast and backs off again, and
+ *             that a time set through the library is not taken for a jump when the time generation exists, or
+ *             is taken for exactly one otherwise. It prints the detection latency and the transactions per
+ *             hour next to polling the individual getters once a second.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Health.h"
+#include "DS3231_BusCounter.h"
+#include "check_common.h"
+
+#define SLOW_MS     30000
+#define FAST_MS     250
+#define TEMP_LOW    (-20 * 4)
+#define TEMP_HIGH   (70 * 4)
+
+static DS3231_BusCounter counter;
+static DS3231_Health health;
+
+/* Board time in ms, the simulator follows it unless its clock is frozen. */
+static uint32_t board_ms, wait_ms;
+static int frozen;
+
+static uint32_t board_tick(void *context) {
+    (void) context;
+    return board_ms;
+}
+
+static void check(int ok, const char *what) {
+    if (check_failed(ok, what))
+        fprintf(stderr, ", health word 0x%08lx\n", (unsigned long) DS3231_Health_Get(&health));
+}
+
+/* Runs the monitor task for the given time, returns the ms until flag first showed, or UINT32_MAX. */
+static uint32_t run(uint32_t ms, uint8_t flag) {
+    uint32_t start = board_ms, seen = UINT32_MAX;
+    while (board_ms - start < ms) {
+        uint32_t step = wait_ms;
+        board_ms += step;
+        if (!frozen)
+            DS3231_Sim_Advance(&sim, step * 1000000ULL);
+        DS3231_Health_Sample(&health, &wait_ms);
+        if (seen == UINT32_MAX && (DS3231_HEALTH_FLAGS(DS3231_Health_Get(&health)) & flag))
+            seen = board_ms - start;
+    }
+    return seen;
+}
+
+/* The monitor is back to the slow period with no fault left. */
+static int settled(void) {
+    return wait_ms == SLOW_MS && DS3231_HEALTH_FLAGS(DS3231_Health_Get(&health)) == DS3231_HEALTH_VALID;
+}
+
+static void report(const char *fault, uint32_t latency, uint8_t anomalies_before) {
+    uint8_t anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    printf("%-30s detected after %6lu ms, %u anomaly(s)\n", fault, (unsigned long) latency,
+           (unsigned) (anomalies - anomalies_before));
+    check(latency <= SLOW_MS + DS3231_HEALTH_BUSY_MS, fault);
+    check(anomalies > anomalies_before, "anomaly count");
+}
+
+int main(void) {
+    DS3231_DateTime start = { DS3231_FRI, 16, 10, 2026, 12, 0, 0, DS3231_ENABLED };
+    uint32_t latency, transactions;
+    uint8_t anomalies;
+
+    check_sim_start();
+    HAL_Host_SetTickSource(board_tick, NULL, NULL);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start);
+    sim.Regs[DS3231_REG_STATUS] &= ~(1 << DS3231_OSF);     /* Cleared by the bring-up once the time is set */
+    DS3231_Sim_SetTemperature(&sim, 25 * 4);
+    DS3231_Health_Init(&health, SLOW_MS, FAST_MS, TEMP_LOW, TEMP_HIGH);
+    wait_ms = FAST_MS;
+
+    /* Healthy: the period backs off to slow and stays there. */
+    run(120000, 0);
+    check(settled(), "healthy settle");
+    DS3231_BusCounter_Reset(&counter);
+    run(3600000, 0);
+    transactions = DS3231_BusCounter_Transactions(&counter);
+    check(settled() && DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health)) == 0, "healthy hour");
+    check(DS3231_HEALTH_TEMPERATURE_Q(DS3231_Health_Get(&health)) == 25 * 4, "temperature in the word");
+    printf("healthy: %lu transactions per hour, individual getters once a second: %u\n",
+           (unsigned long) transactions, 3 * 3600);
+
+    /* OSF persists until the time is set, it must not keep the period fast. */
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    sim.Regs[DS3231_REG_STATUS] |= (1 << DS3231_OSF);
+    latency = run(SLOW_MS, DS3231_HEALTH_OSF);
+    report("oscillator stop flag", latency, anomalies);
+    run(120000, 0);
+    check(wait_ms == SLOW_MS && (DS3231_HEALTH_FLAGS(DS3231_Health_Get(&health)) & DS3231_HEALTH_OSF),
+          "OSF held at the slow period");
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    DS3231_SetDateTime(&start);
+    sim.Regs[DS3231_REG_STATUS] &= ~(1 << DS3231_OSF);
+    run(120000, 0);
+#if DS3231_USE_CACHE || DS3231_USE_ASYNC
+    check(settled() && DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health)) == anomalies,
+          "time set through the library is no jump");
+#else
+    check(settled() && DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health)) == anomalies + 1,
+          "time set through the library is one jump without the generation");
+#endif
+
+    /* BSY set for 5 s from the next slow sample on. */
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    sim.BusyUntil_ns = sim.Now_ns + (wait_ms + 5000) * 1000000ULL;
+    latency = run(SLOW_MS + 5000, DS3231_HEALTH_BUSY_STUCK);
+    report("BSY stuck for 5 s", latency, anomalies);
+    run(120000, 0);
+    check(settled(), "BSY settle");
+
+    /* No acknowledge for 10 s. */
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    DS3231_Sim_SetSupply(&sim, DS3231_SIM_VBAT);
+    latency = run(SLOW_MS, DS3231_HEALTH_BUS_ERROR);
+    report("bus error", latency, anomalies);
+    DS3231_Sim_SetSupply(&sim, DS3231_SIM_VCC);
+    run(120000, 0);
+    check(settled(), "bus settle");
+
+    /* Hour register rewritten without the library, e.g. by another master. */
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    sim.Regs[DS3231_REG_HOUR] = DS3231_EncodeBCD((uint8_t) (DS3231_DecodeBCD(sim.Regs[DS3231_REG_HOUR]) + 1));
+    latency = run(SLOW_MS, DS3231_HEALTH_TIME_JUMP);
+    report("time jump", latency, anomalies);
+    check(wait_ms < SLOW_MS, "fast after a jump");
+    run(120000, 0);
+    check(settled(), "jump settle");
+
+    /* The clock stops counting for 10 s while the board runs. */
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    frozen = 1;
+    latency = run(SLOW_MS, DS3231_HEALTH_STALL);
+    report("stalled clock", latency, anomalies);
+    frozen = 0;
+    run(3000, 0);
+    check(!(DS3231_HEALTH_FLAGS(DS3231_Health_Get(&health)) & DS3231_HEALTH_STALL), "stall cleared");
+    run(120000, 0);
+
+    /* 85 degrees, picked up by the next automatic conversion within 64 s. */
+    anomalies = DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health));
+    DS3231_Sim_SetTemperature(&sim, 85 * 4);
+    latency = run(64000 + SLOW_MS, DS3231_HEALTH_TEMPERATURE);
+    printf("%-30s detected after %6lu ms, within the 64 s conversion period\n", "temperature excursion",
+           (unsigned long) latency);
+    check(latency <= 64000 + SLOW_MS && DS3231_HEALTH_ANOMALIES(DS3231_Health_Get(&health)) > anomalies,
+          "temperature excursion");
+    check(DS3231_HEALTH_TEMPERATURE_Q(DS3231_Health_Get(&health)) == 85 * 4, "temperature in the word");
+
+    return check_report("health monitor");
+}
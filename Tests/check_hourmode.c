@@ -0,0 +1,157 @@
+/**
+ *  @brief     Checks of 12 hour mode support against the simulator.
+ *  @details   Compares DS3231_Hour_Decode and DS3231_Hour_Encode with a plain reference over every register
+ *             value, then runs the driver on the simulator in 12 hour mode: a board left in 12 hour mode by a
+ *             bootloader, DS3231_SetHourMode on the time and alarm registers, the noon and midnight rollovers,
+ *             an alarm that has to match the simulator's 12 hour registers, image advancing and raw time
+ *             ordering across 12 AM. Last, DS3231_Init and DS3231_InitFast boot against a chip in 12 hour mode.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_RawTime.h"
+#include "DS3231_Image.h"
+#include "check_common.h"
+
+static void check(int ok, const char *what) {
+    if (check_failed(ok, what))
+        fprintf(stderr, ", hour register 0x%02x\n", sim.Regs[DS3231_REG_HOUR]);
+}
+
+/* Reference decode, -1 for a register value the device never holds. */
+static int reference_decode(uint8_t reg) {
+    int tens, ones, hour;
+    reg &= 0x7F;
+    if (reg & 0x40) {
+        tens = (reg >> 4) & 0x01;
+        ones = reg & 0x0F;
+        hour = tens * 10 + ones;
+        if (ones > 9 || hour < 1 || hour > 12)
+            return -1;
+        if (hour == 12)
+            hour = 0;
+        return (reg & 0x20) ? hour + 12 : hour;
+    }
+    tens = reg >> 4;
+    ones = reg & 0x0F;
+    hour = tens * 10 + ones;
+    return (ones > 9 || hour > 23) ? -1 : hour;
+}
+
+static void check_codec(void) {
+    unsigned valid = 0;
+    for (unsigned reg = 0; reg < 256; reg++) {
+        const int hour = reference_decode((uint8_t) reg);
+        if (hour < 0)
+            continue;
+        valid++;
+        check(DS3231_Hour_Decode((uint8_t) reg) == hour, "decode");
+        check(DS3231_Hour_Encode((uint8_t) hour, DS3231_Hour_Mode((uint8_t) reg)) == (reg & 0x7F), "encode");
+    }
+    check(valid == 2 * 48, "register values");
+    for (uint8_t hour = 0; hour < 24; hour++) {
+        check(DS3231_Hour_Decode(DS3231_Hour_Encode(hour, DS3231_12H)) == hour, "12 hour round trip");
+        check(DS3231_Hour_Decode(DS3231_Hour_Encode(hour, DS3231_24H)) == hour, "24 hour round trip");
+    }
+    check(DS3231_Hour_Encode(0, DS3231_12H) == 0x52 && DS3231_Hour_Encode(12, DS3231_12H) == 0x72
+          && DS3231_Hour_Encode(23, DS3231_12H) == 0x71 && DS3231_Hour_Encode(9, DS3231_12H) == 0x49,
+          "12 AM, 12 PM, 11 PM, 9 AM");
+}
+
+/* Boards found in 12 hour mode by DS3231_Init and DS3231_InitFast, with the library's mode left at 24 hour. */
+static void check_boot(void) {
+    DS3231_DateTime dt = { DS3231_FRI, 16, 10, 2026, 11, 59, 50, DS3231_ENABLED };
+    DS3231_Config cfg;
+    uint16_t changed = 0xFFFF;
+
+    check_sim_start();
+    DS3231_Init(&hi2c);
+    sim.Regs[DS3231_REG_HOUR] = 0x68;
+    check(DS3231_Init(&hi2c) == HAL_OK && DS3231_SetDateTime(&dt) == HAL_OK && sim.Regs[DS3231_REG_HOUR] == 0x51,
+          "write after DS3231_Init");
+
+    /* Warm boot after other firmware switched the chip: the 8 PM alarm matches as it is. */
+    check(DS3231_SetHourMode(DS3231_24H) == HAL_OK, "back to 24 hour");
+    sim.Regs[DS3231_REG_HOUR] = 0x52;
+    sim.Regs[DS3231_REG_A1_HOUR] = 0x68;
+    sim.Regs[DS3231_REG_A2_HOUR] = 0x52;
+    check(DS3231_GetConfig(&cfg) == HAL_OK && cfg.Alarm1.Hours == 20, "GetConfig");
+    check(DS3231_InitFast(&hi2c, &cfg, DS3231_ENABLED, NULL, &changed) == HAL_OK && changed == 0
+          && sim.Regs[DS3231_REG_A1_HOUR] == 0x68, "DS3231_InitFast writes nothing");
+    check(DS3231_SetDateTime(&dt) == HAL_OK && sim.Regs[DS3231_REG_HOUR] == 0x51, "write after DS3231_InitFast");
+}
+
+static uint8_t read_hour(void) {
+    DS3231_DateTime dt = { 0 };
+    check(DS3231_GetDateTime(&dt) == HAL_OK, "GetDateTime");
+    return dt.Hour_24mode;
+}
+
+int main(void) {
+    DS3231_DateTime dt = { DS3231_FRI, 16, 10, 2026, 11, 59, 50, DS3231_ENABLED };
+    D3231_Alarm1 alarm = { 0, 0, 13, 0, DS3231_A1_MATCH_S_M_H, DS3231_ENABLED }, back;
+    DS3231_HourMode mode = DS3231_24H;
+    DS3231_State flag;
+    uint8_t regs[7], other[7];
+
+    check_codec();
+
+    check_sim_start();
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&dt);
+    check(sim.Regs[DS3231_REG_HOUR] == 0x11, "24 hour write");
+
+    /* 8 PM as a bootloader left it, masking with 0x3F used to read 28. */
+    sim.Regs[DS3231_REG_HOUR] = 0x68;
+    check(read_hour() == 20, "bootloader 12 hour mode");
+    check(DS3231_GetHourMode(&mode) == HAL_OK && mode == DS3231_12H, "GetHourMode");
+
+    /* Switching keeps the time and converts both alarm hour registers, mask bits included. */
+    check(DS3231_SetHourMode(DS3231_24H) == HAL_OK && sim.Regs[DS3231_REG_HOUR] == 0x20, "to 24 hour");
+    DS3231_SetDateTime(&dt);
+    check(DS3231_SetAlarm1(&alarm) == HAL_OK && sim.Regs[DS3231_REG_A1_HOUR] == 0x13, "24 hour alarm");
+    sim.Regs[DS3231_REG_A2_HOUR] = 0x80 | 0x23;
+    check(DS3231_SetHourMode(DS3231_12H) == HAL_OK, "SetHourMode");
+    check(sim.Regs[DS3231_REG_HOUR] == 0x51 && sim.Regs[DS3231_REG_A1_HOUR] == 0x61
+          && sim.Regs[DS3231_REG_A2_HOUR] == (0x80 | 0x71), "to 12 hour");
+    check(DS3231_GetAlarm1(&back) == HAL_OK && back.Hours == 13, "GetAlarm1 in 12 hour mode");
+
+    /* 11:59:50 AM to 12 PM on the simulator's own 12 hour counter. */
+    DS3231_Sim_Advance(&sim, 15 * 1000000000ULL);
+    check(sim.Regs[DS3231_REG_HOUR] == 0x72 && read_hour() == 12, "noon");
+
+    /* The 13:00 alarm matches 1 PM in 12 hour registers. */
+    DS3231_ClearAlarm1Flag();
+    DS3231_Sim_Advance(&sim, 3600 * 1000000000ULL);
+    check(DS3231_GetAlarm1Flag(&flag) == HAL_OK && flag == DS3231_ENABLED && read_hour() == 13, "1 PM alarm");
+
+    /* SetDateTime writes in the mode of the device, midnight is 12 AM. */
+    dt.Hour_24mode = 23;
+    dt.Minute = 59;
+    dt.Second = 58;
+    DS3231_SetDateTime(&dt);
+    check(sim.Regs[DS3231_REG_HOUR] == 0x71, "11 PM write");
+    DS3231_Sim_Advance(&sim, 3 * 1000000000ULL);
+    check(sim.Regs[DS3231_REG_HOUR] == 0x52 && read_hour() == 0, "midnight");
+
+    /* No switch in the last second of an hour, the hour could roll over before the write. */
+    dt.Hour_24mode = 10;
+    dt.Second = 59;
+    DS3231_SetDateTime(&dt);
+    check(DS3231_SetHourMode(DS3231_24H) == HAL_BUSY && sim.Regs[DS3231_REG_HOUR] == 0x50, "busy at xx:59:59");
+
+    /* Images advance in the mode they hold, raw times order across 12 AM. */
+    DS3231_ReadRegisters(DS3231_REG_SECOND, regs, 7);
+    regs[DS3231_REG_HOUR] = 0x71;
+    check(DS3231_Image_Advance(regs, 3600) == HAL_OK && regs[DS3231_REG_HOUR] == 0x52, "image advance");
+    for (unsigned i = 0; i < 7; i++)
+        other[i] = regs[i];
+    other[DS3231_REG_HOUR] = 0x41;
+    check(DS3231_RawTime_Compare(DS3231_RAWTIME(regs), DS3231_RAWTIME(other)) < 0, "12 AM before 1 AM");
+    check(DS3231_RawTime_Hour(DS3231_RAWTIME(other)) == 1, "raw hour");
+
+    check_boot();
+
+    return check_report("12 hour mode");
+}
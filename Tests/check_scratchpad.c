@@ -0,0 +1,87 @@
+/**
+ *  @brief     Checks of the Alarm 2 scratchpad against the simulator.
+ *  @details   Round trips every 16-bit value through #DS3231_Scratchpad_Pack/#DS3231_Scratchpad_Unpack, checks that
+ *             every single and double bit error in an image is rejected, that the power-on registers and all
+ *             valid Alarm 2 settings are not taken for scratchpad data, that A2IE makes both calls refuse,
+ *             that no stored value raises A2F while the simulator runs through two days and that switching the
+ *             hour mode keeps the data.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Scratchpad.h"
+
+#define CHECK_REPORT_LIMIT  10
+#include "check_common.h"
+
+static void check(int ok, const char *what, unsigned value) {
+    if (check_failed(ok, what))
+        fprintf(stderr, " for 0x%04x\n", value);
+}
+
+int main(void) {
+    static const DS3231_Alarm2Mode modes[] = { DS3231_A2_EVERY_M, DS3231_A2_MATCH_M, DS3231_A2_MATCH_M_H,
+            DS3231_A2_MATCH_M_H_DATE, DS3231_A2_MATCH_M_H_DAY };
+    DS3231_DateTime start = { DS3231_FRI, 16, 10, 2026, 23, 59, 30, DS3231_ENABLED };
+    uint8_t image[DS3231_SCRATCHPAD_LEN], zero[DS3231_SCRATCHPAD_LEN] = { 0 };
+    uint16_t data;
+
+    for (uint32_t value = 0; value <= 0xFFFF; value++) {
+        DS3231_Scratchpad_Pack((uint16_t) value, image);
+        check(DS3231_Scratchpad_Unpack(image, &data) == HAL_OK && data == value, "round trip", value);
+        for (int i = 0; i < DS3231_SCRATCHPAD_LEN * 8; i++) {
+            for (int j = i; j < DS3231_SCRATCHPAD_LEN * 8; j++) {
+                uint8_t bad[DS3231_SCRATCHPAD_LEN] = { image[0], image[1], image[2] };
+                bad[i / 8] ^= (uint8_t) (1 << (i % 8));
+                if (j != i)
+                    bad[j / 8] ^= (uint8_t) (1 << (j % 8));
+                check(DS3231_Scratchpad_Unpack(bad, &data) == HAL_ERROR, "bit error", value);
+            }
+        }
+    }
+    check(DS3231_Scratchpad_Unpack(zero, &data) == HAL_ERROR, "power-on registers", 0);
+
+    check_sim_start();
+    DS3231_Init(&hi2c);
+    DS3231_SetDateTime(&start);
+
+    for (int m = 0; m < 5; m++) {
+        for (uint8_t minute = 0; minute < 60; minute++) {
+            D3231_Alarm2 alarm = { minute, (uint8_t) (minute % 24), (uint8_t) (1 + minute % 7), modes[m],
+                    DS3231_DISABLED };
+            DS3231_SetAlarm2(&alarm);
+            check(DS3231_Scratchpad_Read(&data) == HAL_ERROR, "alarm taken for data", minute);
+        }
+    }
+
+    DS3231_SetAlarm2IntEn(DS3231_ENABLED);
+    check(DS3231_Scratchpad_Write(1) == HAL_ERROR, "write with A2IE", 1);
+    DS3231_SetAlarm2IntEn(DS3231_DISABLED);
+    check(DS3231_Scratchpad_Write(1) == HAL_OK, "write", 1);
+    DS3231_SetAlarm2IntEn(DS3231_ENABLED);
+    check(DS3231_Scratchpad_Read(&data) == HAL_ERROR, "read with A2IE", 1);
+    DS3231_SetAlarm2IntEn(DS3231_DISABLED);
+
+    /* A new value every 3 minutes, each must survive and none may match the time registers. */
+    DS3231_ClearAlarm2Flag();
+    for (uint32_t step = 0; step < 2 * 24 * 20; step++) {
+        uint16_t value = (uint16_t) (step * 40503U);
+        DS3231_State a2f;
+        check(DS3231_Scratchpad_Write(value) == HAL_OK, "write", value);
+        DS3231_Sim_AdvanceSeconds(&sim, 180);
+        check(DS3231_Scratchpad_Read(&data) == HAL_OK && data == value, "read back", value);
+        DS3231_GetAlarm2Flag(&a2f);
+        check(a2f == DS3231_DISABLED, "A2F raised", value);
+    }
+
+    /* Switching the hour mode converts Alarm 1 only. */
+    check(DS3231_Scratchpad_Write(0x1234) == HAL_OK, "write", 0x1234);
+    check(DS3231_SetHourMode(DS3231_12H) == HAL_OK && DS3231_Scratchpad_Read(&data) == HAL_OK && data == 0x1234,
+          "12 hour mode", 0x1234);
+    check(DS3231_SetHourMode(DS3231_24H) == HAL_OK && DS3231_Scratchpad_Read(&data) == HAL_OK && data == 0x1234,
+          "24 hour mode", 0x1234);
+
+    printf("scratchpad: %u failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+/**
+ *  @brief     Checks of the fused range check and encode of DS3231_SetDateTime.
+ *  @details   Compares DS3231_EncodeDateTime with a plain reference for every day of 2000 to 2199 and for each
+ *             field one past its bounds, and advances each day to the next with DS3231_Image_Advance. Then runs
+ *             DS3231_SetDateTime on the simulator: invalid dates and times must return HAL_ERROR without a bus
+ *             transaction, years from 2100 on must set the century bit and read back, and the simulator's year
+ *             rollover into the next century must read back as 2100.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231_Image.h"
+#include "check_common.h"
+
+#include <string.h>
+
+static void check(int ok, const char *what, const DS3231_DateTime *dt) {
+    if (check_failed(ok, what))
+        fprintf(stderr, " for %04u-%02u-%02u %02u:%02u:%02u day %u\n", dt->Year, dt->Month, dt->Date, dt->Hour_24mode,
+                dt->Minute, dt->Second, dt->Day);
+}
+
+static uint8_t reference_bcd(unsigned value) {
+    return (uint8_t) ((value / 10) << 4 | value % 10);
+}
+
+static unsigned reference_days(unsigned year, unsigned month) {
+    static const uint8_t days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const int leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return days[month - 1] + (month == 2 && leap);
+}
+
+/* Every valid date of the two centuries the registers hold, with the time varying along. Each day is also
+   reached by advancing the registers of the day before. */
+static void check_valid(void) {
+    DS3231_DateTime dt = { DS3231_MON, 1, 1, 2000, 0, 0, 0, DS3231_ENABLED };
+    unsigned n = 0;
+    uint32_t seconds = 0, before = 0;
+    uint8_t regs[7], advanced[7];
+    for (unsigned year = 2000; year < 2200; year++) {
+        for (unsigned month = 1; month <= 12; month++) {
+            for (unsigned date = 1; date <= reference_days(year, month); date++, n++) {
+                dt.Year = (uint16_t) year;
+                dt.Month = (uint8_t) month;
+                dt.Date = (uint8_t) date;
+                dt.Day = (uint8_t) ((n + 5) % 7 + 1);     /* 2000-01-01 was a Saturday */
+                dt.Hour_24mode = (uint8_t) (n % 24);
+                dt.Minute = (uint8_t) (n % 60);
+                dt.Second = (uint8_t) (n * 7 % 60);
+                check(DS3231_EncodeDateTime(&dt, DS3231_24H, regs) == 0, "valid date", &dt);
+                check(regs[0] == reference_bcd(dt.Second) && regs[1] == reference_bcd(dt.Minute)
+                      && regs[2] == reference_bcd(dt.Hour_24mode) && regs[3] == dt.Day
+                      && regs[4] == reference_bcd(date)
+                      && regs[5] == (reference_bcd(month) | (year >= 2100) << DS3231_CENTURY)
+                      && regs[6] == reference_bcd(year % 100), "encode", &dt);
+                seconds = dt.Hour_24mode * 3600U + dt.Minute * 60U + dt.Second;
+                if (n == 0)
+                    memcpy(advanced, regs, sizeof(regs));
+                else
+                    check(DS3231_Image_Advance(advanced, 86400U + seconds - before) == HAL_OK
+                          && memcmp(advanced, regs, sizeof(regs)) == 0, "image advance", &dt);
+                before = seconds;
+                check(DS3231_EncodeDateTime(&dt, DS3231_12H, regs) == 0
+                      && regs[2] == DS3231_Hour_Encode(dt.Hour_24mode, DS3231_12H), "12 hour encode", &dt);
+            }
+        }
+    }
+    check(n == 73049, "day count", &dt);
+    check(DS3231_Image_Advance(advanced, 86400U) == HAL_ERROR, "image advance past 2199", &dt);
+}
+
+/* One field out of range at a time, the mask names exactly that register. */
+static void check_invalid(void) {
+    static const struct {
+        uint8_t Day, Date, Month;
+        uint16_t Year;
+        uint8_t Hour, Minute, Second, Mask;
+    } cases[] = {
+        { 3, 29, 2, 2023, 12, 0, 0, 1 << DS3231_REG_DATE },     /* Not a leap year */
+        { 3, 29, 2, 2100, 12, 0, 0, 1 << DS3231_REG_DATE },     /* Century year, not a leap year */
+        { 3, 30, 2, 2024, 12, 0, 0, 1 << DS3231_REG_DATE },
+        { 3, 31, 4, 2026, 12, 0, 0, 1 << DS3231_REG_DATE },
+        { 3, 0, 4, 2026, 12, 0, 0, 1 << DS3231_REG_DATE },
+        { 3, 32, 1, 2026, 12, 0, 0, 1 << DS3231_REG_DATE },
+        { 3, 1, 0, 2026, 12, 0, 0, 1 << DS3231_REG_MONTH | 1 << DS3231_REG_DATE },
+        { 3, 1, 13, 2026, 12, 0, 0, 1 << DS3231_REG_MONTH | 1 << DS3231_REG_DATE },
+        { 0, 1, 1, 2026, 12, 0, 0, 1 << DS3231_REG_DAY },
+        { 8, 1, 1, 2026, 12, 0, 0, 1 << DS3231_REG_DAY },
+        { 3, 1, 1, 2026, 24, 0, 0, 1 << DS3231_REG_HOUR },
+        { 3, 1, 1, 2026, 12, 60, 0, 1 << DS3231_REG_MINUTE },
+        { 3, 1, 1, 2026, 12, 0, 60, 1 << DS3231_REG_SECOND },
+        { 3, 1, 1, 1999, 12, 0, 0, 1 << DS3231_REG_YEAR },
+        { 3, 1, 1, 2200, 12, 0, 0, 1 << DS3231_REG_YEAR },
+        { 3, 1, 1, 2026, 255, 255, 255, 1 << DS3231_REG_HOUR | 1 << DS3231_REG_MINUTE | 1 << DS3231_REG_SECOND },
+    };
+    uint8_t regs[7], before[7];
+    for (unsigned i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        DS3231_DateTime dt = { cases[i].Day, cases[i].Date, cases[i].Month, cases[i].Year, cases[i].Hour,
+                cases[i].Minute, cases[i].Second, DS3231_ENABLED };
+        uint32_t reads = sim.ReadTransactions, writes = sim.WriteTransactions;
+        for (unsigned r = 0; r < 7; r++)
+            before[r] = sim.Regs[r];
+        check(DS3231_EncodeDateTime(&dt, DS3231_24H, regs) == cases[i].Mask, "mask", &dt);
+        check(DS3231_SetDateTime(&dt) == HAL_ERROR, "SetDateTime error", &dt);
+        check(sim.ReadTransactions == reads && sim.WriteTransactions == writes, "no bus traffic", &dt);
+        for (unsigned r = 0; r < 7; r++)
+            check(sim.Regs[r] == before[r], "registers untouched", &dt);
+    }
+}
+
+int main(void) {
+    DS3231_DateTime dt = { DS3231_FRI, 15, 6, 2150, 8, 30, 0, DS3231_ENABLED }, back = { 0 };
+    uint8_t regs[7];
+
+    check_valid();
+
+    /* Past the end of 32-bit unix time. */
+    DS3231_EncodeDateTime(&dt, DS3231_24H, regs);
+    check(DS3231_Image_Advance(regs, 60) == HAL_OK && regs[DS3231_REG_MINUTE] == 0x31
+          && regs[DS3231_REG_YEAR] == 0x50 && regs[DS3231_REG_MONTH] == (0x06 | 1 << DS3231_CENTURY), "2150 advance",
+          &dt);
+
+    check_sim_start();
+    DS3231_Init(&hi2c);
+    check_invalid();
+
+    /* The century bit is written and read back. */
+    check(DS3231_SetDateTime(&dt) == HAL_OK && (sim.Regs[DS3231_REG_MONTH] >> DS3231_CENTURY) == 1
+          && sim.Regs[DS3231_REG_YEAR] == 0x50, "2150 write", &dt);
+    check(DS3231_GetDateTime(&back) == HAL_OK && back.Year == 2150 && back.Month == 6 && back.Date == 15,
+          "2150 read", &back);
+
+    /* The simulator carries 2099 into the century bit. */
+    dt.Year = 2099;
+    dt.Month = 12;
+    dt.Date = 31;
+    dt.Hour_24mode = 23;
+    dt.Minute = 59;
+    dt.Second = 59;
+    check(DS3231_SetDateTime(&dt) == HAL_OK && (sim.Regs[DS3231_REG_MONTH] >> DS3231_CENTURY) == 0, "2099 write",
+          &dt);
+    DS3231_Sim_Advance(&sim, 2 * 1000000000ULL);
+    check(DS3231_GetDateTime(&back) == HAL_OK && back.Year == 2100 && back.Month == 1 && back.Date == 1,
+          "2100 rollover", &back);
+
+    return check_report("SetDateTime");
+}
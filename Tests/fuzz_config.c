@@ -0,0 +1,171 @@
+/**
+ *  @brief     Differential check of DS3231_ApplyConfig against the individual setters.
+ *  @details   For random starting register contents and random desired configurations, two simulators are
+ *             brought to the configuration, one through the setters and one through #DS3231_ApplyConfig. Their
+ *             configuration registers must end up equal, the alarm flags and OSF must be preserved, the
+ *             reported change flags must match #DS3231_GetConfig before the call, #DS3231_GetConfig must read
+ *             the configuration back and a second #DS3231_ApplyConfig must change nothing in one transaction.
+ *             #DS3231_InitFast on the configured chip must write nothing and report the flags as found.\n
+ *             fuzz_config [--iterations N] [--seed S]
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+
+#include "DS3231.h"
+#include "DS3231_Sim.h"
+#include "DS3231_BusCounter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FLAGS   ((1 << DS3231_OSF) | (1 << DS3231_A2F) | (1 << DS3231_A1F))
+
+static DS3231_Sim sim;
+static DS3231_BusCounter counter;
+static I2C_HandleTypeDef hi2c;
+
+static uint32_t rng_state;
+
+static uint32_t fuzz_rand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void random_config(DS3231_Config *cfg) {
+    static const DS3231_Alarm1Mode a1_modes[] = { DS3231_A1_EVERY_S, DS3231_A1_MATCH_S, DS3231_A1_MATCH_S_M,
+            DS3231_A1_MATCH_S_M_H, DS3231_A1_MATCH_S_M_H_DATE, DS3231_A1_MATCH_S_M_H_DAY };
+    static const DS3231_Alarm2Mode a2_modes[] = { DS3231_A2_EVERY_M, DS3231_A2_MATCH_M, DS3231_A2_MATCH_M_H,
+            DS3231_A2_MATCH_M_H_DATE, DS3231_A2_MATCH_M_H_DAY };
+    cfg->Oscillator = fuzz_rand() & 1;
+    cfg->BatterySquareWave = fuzz_rand() & 1;
+    cfg->InterruptMode = fuzz_rand() & 1;
+    cfg->Rate = fuzz_rand() & 3;
+    cfg->Output32kHz = fuzz_rand() & 1;
+    cfg->AgingOffset = (fuzz_rand() & 3) ? 0 : (int8_t) fuzz_rand();
+    cfg->Alarm1.Mode = a1_modes[fuzz_rand() % 6];
+    cfg->Alarm1.Seconds = fuzz_rand() % 60;
+    cfg->Alarm1.Minutes = fuzz_rand() % 60;
+    cfg->Alarm1.Hours = fuzz_rand() % 24;
+    cfg->Alarm1.DayDate = cfg->Alarm1.Mode == DS3231_A1_MATCH_S_M_H_DAY ? 1 + fuzz_rand() % 7 : 1 + fuzz_rand() % 31;
+    cfg->Alarm1.IntEn = fuzz_rand() & 1;
+    cfg->Alarm2.Mode = a2_modes[fuzz_rand() % 5];
+    cfg->Alarm2.Minutes = fuzz_rand() % 60;
+    cfg->Alarm2.Hours = fuzz_rand() % 24;
+    cfg->Alarm2.DayDate = cfg->Alarm2.Mode == DS3231_A2_MATCH_M_H_DAY ? 1 + fuzz_rand() % 7 : 1 + fuzz_rand() % 31;
+    cfg->Alarm2.IntEn = fuzz_rand() & 1;
+}
+
+/* Random contents of the configuration registers, sometimes close to the target so only a few bytes differ. */
+static void random_registers(const DS3231_Config *near) {
+    for (uint8_t reg = DS3231_REG_A1_SECOND; reg <= DS3231_REG_AGING; reg++)
+        sim.Regs[reg] = (uint8_t) fuzz_rand();
+    sim.Regs[DS3231_REG_CONTROL] &= ~(1 << DS3231_CONV);
+    sim.Regs[DS3231_REG_STATUS] &= FLAGS | (1 << DS3231_EN32KHZ);   /* Bits 6..4 read 0, BSY is clear */
+    if (fuzz_rand() & 1) {
+        DS3231_Config cfg = *near;
+        uint8_t status = sim.Regs[DS3231_REG_STATUS];
+        cfg.Alarm1.Seconds = fuzz_rand() % 60;
+        cfg.Rate = fuzz_rand() & 3;
+        DS3231_ApplyConfig(&cfg, NULL);
+        sim.Regs[DS3231_REG_STATUS] = (sim.Regs[DS3231_REG_STATUS] & ~FLAGS) | (status & FLAGS);
+    }
+}
+
+static void apply_setters(DS3231_Config *cfg) {
+    DS3231_SetAlarm1(&cfg->Alarm1);
+    DS3231_SetAlarm2(&cfg->Alarm2);
+    DS3231_SetRateSelect(cfg->Rate);
+    DS3231_SetInterruptMode(cfg->InterruptMode);
+    DS3231_SetOscillator(cfg->Oscillator);
+    DS3231_SetBatterySquareWave(cfg->BatterySquareWave);
+    DS3231_Set32kHzOutput(cfg->Output32kHz);
+    DS3231_WriteRegister(DS3231_REG_AGING, (uint8_t *) &cfg->AgingOffset);
+}
+
+static uint16_t expected_changes(const DS3231_Config *a, const DS3231_Config *b) {
+    uint16_t flags = 0;
+    flags |= a->Oscillator != b->Oscillator ? DS3231_CHANGED_OSCILLATOR : 0;
+    flags |= a->BatterySquareWave != b->BatterySquareWave ? DS3231_CHANGED_BBSQW : 0;
+    flags |= a->InterruptMode != b->InterruptMode ? DS3231_CHANGED_INTCN : 0;
+    flags |= a->Rate != b->Rate ? DS3231_CHANGED_RATE : 0;
+    flags |= a->Output32kHz != b->Output32kHz ? DS3231_CHANGED_32KHZ : 0;
+    flags |= a->AgingOffset != b->AgingOffset ? DS3231_CHANGED_AGING : 0;
+    flags |= a->Alarm1.IntEn != b->Alarm1.IntEn ? DS3231_CHANGED_A1IE : 0;
+    flags |= a->Alarm2.IntEn != b->Alarm2.IntEn ? DS3231_CHANGED_A2IE : 0;
+    return flags;
+}
+
+static int same_config(const DS3231_Config *a, const DS3231_Config *b) {
+    return expected_changes(a, b) == 0 && a->Alarm1.Mode == b->Alarm1.Mode && a->Alarm1.Seconds == b->Alarm1.Seconds
+            && a->Alarm1.Minutes == b->Alarm1.Minutes && a->Alarm1.Hours == b->Alarm1.Hours
+            && a->Alarm1.DayDate == b->Alarm1.DayDate && a->Alarm2.Mode == b->Alarm2.Mode
+            && a->Alarm2.Minutes == b->Alarm2.Minutes && a->Alarm2.Hours == b->Alarm2.Hours
+            && a->Alarm2.DayDate == b->Alarm2.DayDate;
+}
+
+int main(int argc, char **argv) {
+    uint32_t iterations = 200000, failures = 0, writes = 0;
+    DS3231_Sim start, by_setters;
+
+    rng_state = 0x1234567UL;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--iterations") == 0)
+            iterations = strtoul(argv[i + 1], NULL, 0);
+        else if (strcmp(argv[i], "--seed") == 0)
+            rng_state = strtoul(argv[i + 1], NULL, 0) | 1;
+    }
+
+    DS3231_Sim_Init(&sim);
+    DS3231_Sim_Attach(&sim, &hi2c);
+    DS3231_BusCounter_Init(&counter, &hi2c);
+    DS3231_Init(&hi2c);
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        DS3231_Config cfg, before, after;
+        uint16_t changed, again;
+        uint8_t events;
+        int bad = 0;
+
+        random_config(&cfg);
+        random_registers(&cfg);
+        start = sim;
+        DS3231_GetConfig(&before);
+
+        apply_setters(&cfg);
+        by_setters = sim;
+
+        sim = start;
+        DS3231_BusCounter_Reset(&counter);
+        if (DS3231_ApplyConfig(&cfg, &changed) != HAL_OK)
+            bad |= 1;
+        writes += counter.Writes;
+        if (memcmp(&sim.Regs[DS3231_REG_A1_SECOND], &by_setters.Regs[DS3231_REG_A1_SECOND],
+                   DS3231_REG_AGING - DS3231_REG_A1_SECOND + 1) != 0)
+            bad |= 2;
+        if ((sim.Regs[DS3231_REG_STATUS] & FLAGS) != (start.Regs[DS3231_REG_STATUS] & FLAGS))
+            bad |= 4;
+        if ((changed & ~(DS3231_CHANGED_ALARM1 | DS3231_CHANGED_ALARM2)) != expected_changes(&before, &cfg))
+            bad |= 8;
+        DS3231_GetConfig(&after);
+        if (!same_config(&after, &cfg))
+            bad |= 16;
+        DS3231_BusCounter_Reset(&counter);
+        DS3231_ApplyConfig(&cfg, &again);
+        if (again != 0 || DS3231_BusCounter_Transactions(&counter) != 1)
+            bad |= 32;
+        DS3231_BusCounter_Reset(&counter);
+        if (DS3231_InitFast(&hi2c, &cfg, (DS3231_State) (it & 1), &events, &again) != HAL_OK || again != 0
+                || events != (start.Regs[DS3231_REG_STATUS] & FLAGS) || counter.Writes != 0)
+            bad |= 64;
+
+        if (bad && failures++ < 10)
+            fprintf(stderr, "iteration %lu: failed checks 0x%02x\n", (unsigned long) it, bad);
+    }
+    printf("%lu configurations, %.2f writes per DS3231_ApplyConfig, %lu failures\n", (unsigned long) iterations,
+           (double) writes / iterations, (unsigned long) failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,193 @@
+/**
+ *  @brief     Differential check of DS3231_ToDateTime/DS3231_ToUnixTime against libc timegm/gmtime_r.
+ *  @details   Every field is compared, including the day of week. Built with -DDS3231_LIBFUZZER it is a
+ *             libFuzzer target, otherwise a standalone sweep over the whole 32-bit unix range:\n
+ *             fuzz_conversions [--threads N] [--samples-per-day K] [--all-seconds]\n
+ *             The default sweep visits every day of the range at several times of day, the first and last
+ *             second included, and finishes in well under a second per thread.
+ *  @author    Sumant Khalate www.github.com/SumantKhalate/DS3231
+ *  @date      October 2026
+ *  @copyright GPL-3.0 license.
+ */
+#define _GNU_SOURCE
+
+#include "DS3231.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SECONDS_PER_DAY     86400UL
+#define LAST_DAY            (0xFFFFFFFFUL / SECONDS_PER_DAY)
+
+/**
+ * @brief Compares both conversions for one unix time.
+ * @return 0 when the library agrees with libc.
+ */
+static int check_unix(uint32_t t, int verbose) {
+    DS3231_DateTime dt;
+    struct tm tm;
+    time_t tt = (time_t) t;
+    uint32_t back = 0;
+    gmtime_r(&tt, &tm);
+    DS3231_ToDateTime(&t, &dt);
+    if (dt.Year != tm.tm_year + 1900 || dt.Month != tm.tm_mon + 1 || dt.Date != tm.tm_mday
+            || dt.Hour_24mode != tm.tm_hour || dt.Minute != tm.tm_min || dt.Second != tm.tm_sec
+            || dt.Day != (tm.tm_wday == 0 ? DS3231_SUN : tm.tm_wday)) {
+        if (verbose)
+            fprintf(stderr, "ToDateTime(%lu): got %04u-%02u-%02u %02u:%02u:%02u dow %u, "
+                    "expected %04d-%02d-%02d %02d:%02d:%02d dow %d\n", (unsigned long) t, dt.Year, dt.Month,
+                    dt.Date, dt.Hour_24mode, dt.Minute, dt.Second, dt.Day, tm.tm_year + 1900, tm.tm_mon + 1,
+                    tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, tm.tm_wday == 0 ? 7 : tm.tm_wday);
+        return 1;
+    }
+    DS3231_ToUnixTime(&dt, &back);
+    if (back != t || (uint32_t) timegm(&tm) != t) {
+        if (verbose)
+            fprintf(stderr, "ToUnixTime(%04u-%02u-%02u %02u:%02u:%02u): got %lu, expected %lu\n", dt.Year, dt.Month,
+                    dt.Date, dt.Hour_24mode, dt.Minute, dt.Second, (unsigned long) back, (unsigned long) t);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Compares DS3231_ToUnixTime with timegm for arbitrary in-range fields.
+ */
+static int check_fields(uint16_t year, uint8_t month, uint8_t date, uint8_t hour, uint8_t minute, uint8_t second) {
+    DS3231_DateTime dt = { 0 };
+    struct tm tm = { 0 };
+    uint32_t got = 0;
+    time_t expected;
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = date;
+    tm.tm_hour = hour;
+    tm.tm_min = minute;
+    tm.tm_sec = second;
+    expected = timegm(&tm);
+    if (tm.tm_mday != date || expected < 0 || expected > (time_t) 0xFFFFFFFFUL)
+        return 0;       // Not a real date (e.g. 31 April) or outside the 32-bit range.
+    dt.Year = year;
+    dt.Month = month;
+    dt.Date = date;
+    dt.Hour_24mode = hour;
+    dt.Minute = minute;
+    dt.Second = second;
+    DS3231_ToUnixTime(&dt, &got);
+    if (got != (uint32_t) expected) {
+        fprintf(stderr, "ToUnixTime(%04u-%02u-%02u %02u:%02u:%02u): got %lu, expected %lld\n", year, month, date,
+                hour, minute, second, (unsigned long) got, (long long) expected);
+        return 1;
+    }
+    return check_unix(got, 1);
+}
+
+#ifdef DS3231_LIBFUZZER
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    if (size >= 4) {
+        uint32_t t = (uint32_t) data[0] | (uint32_t) data[1] << 8 | (uint32_t) data[2] << 16
+                   | (uint32_t) data[3] << 24;
+        if (check_unix(t, 1))
+            abort();
+    }
+    if (size >= 10) {
+        uint16_t year = 1970 + (uint16_t) ((data[4] | data[5] << 8) % 137);
+        if (check_fields(year, data[6] % 12 + 1, data[7] % 31 + 1, data[8] % 24, data[9] % 60, data[4] % 60))
+            abort();
+    }
+    return 0;
+}
+#else
+#include <pthread.h>
+
+typedef struct SweepJob {
+    pthread_t thread;
+    uint32_t first_day;
+    uint32_t last_day;
+    uint32_t samples;       /* Seconds checked per day, 0 checks every second */
+    unsigned long checked;
+    unsigned long failures;
+} SweepJob;
+
+static void *sweep(void *arg) {
+    SweepJob *job = (SweepJob*) arg;
+    uint32_t rng = 0x6D2B79F5UL ^ job->first_day;
+    for (uint32_t day = job->first_day; day <= job->last_day; day++) {
+        uint32_t base = day * SECONDS_PER_DAY;
+        uint32_t span = day == LAST_DAY ? 0xFFFFFFFFUL - base + 1 : SECONDS_PER_DAY;
+        if (job->samples == 0) {
+            for (uint32_t s = 0; s < span; s++, job->checked++)
+                job->failures += check_unix(base + s, job->failures < 10);
+            continue;
+        }
+        /* Midnight and the last second of the day, the rest spread at random. */
+        job->failures += check_unix(base, job->failures < 10);
+        job->failures += check_unix(base + span - 1, job->failures < 10);
+        job->checked += 2;
+        for (uint32_t k = 2; k < job->samples; k++, job->checked++) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            job->failures += check_unix(base + rng % span, job->failures < 10);
+        }
+    }
+    return NULL;
+}
+
+static unsigned long check_fields_sweep(void) {
+    unsigned long failures = 0;
+    for (uint16_t year = 1970; year <= 2106; year++)
+        for (uint8_t month = 1; month <= 12; month++)
+            for (uint8_t date = 1; date <= 31; date++)
+                failures += check_fields(year, month, date, (uint8_t) (year % 24), month, date);
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    unsigned threads = 4, samples = 4;
+    unsigned long checked = 0, failures;
+    SweepJob *jobs;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = (unsigned) strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--samples-per-day") == 0 && i + 1 < argc)
+            samples = (unsigned) strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--all-seconds") == 0)
+            samples = 0;
+        else {
+            fprintf(stderr, "usage: %s [--threads N] [--samples-per-day K] [--all-seconds]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (threads == 0)
+        threads = 1;
+    if (samples == 1)
+        samples = 2;
+
+    setenv("TZ", "UTC", 1);
+    tzset();
+    failures = check_fields_sweep();
+
+    jobs = calloc(threads, sizeof(*jobs));
+    if (jobs == NULL)
+        return 2;
+    for (unsigned i = 0; i < threads; i++) {
+        jobs[i].first_day = (uint32_t) ((uint64_t) (LAST_DAY + 1) * i / threads);
+        jobs[i].last_day = (uint32_t) ((uint64_t) (LAST_DAY + 1) * (i + 1) / threads - 1);
+        jobs[i].samples = samples;
+        pthread_create(&jobs[i].thread, NULL, sweep, &jobs[i]);
+    }
+    for (unsigned i = 0; i < threads; i++) {
+        pthread_join(jobs[i].thread, NULL);
+        checked += jobs[i].checked;
+        failures += jobs[i].failures;
+    }
+    free(jobs);
+
+    printf("checked %lu unix times over %lu days on %u threads: %lu mismatches\n", checked,
+           (unsigned long) LAST_DAY + 1, threads, failures);
+    return failures ? 1 : 0;
+}
+#endif
@@ -0,0 +1,27 @@
+# Cross toolchain for STM32 targets:
+#   cmake -S . -B build-arm -DCMAKE_TOOLCHAIN_FILE=cmake/arm-none-eabi.cmake \
+#         -DDS3231_HAL_INCLUDE_DIR=<CubeMX project>/Core/Inc -DDS3231_MCPU=cortex-m0plus
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(DS3231_TOOLCHAIN_PREFIX "arm-none-eabi-" CACHE STRING "Prefix of the cross toolchain executables")
+set(DS3231_MCPU "cortex-m0plus" CACHE STRING "Value passed to -mcpu")
+set(DS3231_MFLOAT "" CACHE STRING "Extra floating point flags, e.g. -mfpu=fpv4-sp-d16 -mfloat-abi=hard")
+
+set(CMAKE_C_COMPILER ${DS3231_TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_CXX_COMPILER ${DS3231_TOOLCHAIN_PREFIX}g++)
+set(CMAKE_ASM_COMPILER ${DS3231_TOOLCHAIN_PREFIX}gcc)
+set(CMAKE_AR ${DS3231_TOOLCHAIN_PREFIX}ar)
+set(CMAKE_OBJCOPY ${DS3231_TOOLCHAIN_PREFIX}objcopy)
+set(CMAKE_SIZE ${DS3231_TOOLCHAIN_PREFIX}size)
+
+set(CMAKE_C_FLAGS_INIT "-mcpu=${DS3231_MCPU} -mthumb ${DS3231_MFLOAT}")
+set(CMAKE_CXX_FLAGS_INIT "-mcpu=${DS3231_MCPU} -mthumb ${DS3231_MFLOAT}")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "--specs=nano.specs --specs=nosys.specs")
+
+# Only static libraries are produced for the target, the firmware project links them.
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)